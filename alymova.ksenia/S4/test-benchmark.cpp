@@ -0,0 +1,63 @@
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <tree/tree-2-3.hpp>
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#include <malloc.h>
+#define ALYMOVA_HAS_MALLINFO2
+#endif
+
+namespace
+{
+  using Clock = std::chrono::steady_clock;
+
+  size_t heapInUse()
+  {
+#ifdef ALYMOVA_HAS_MALLINFO2
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+  }
+
+  template< class Tree, class MakeKey >
+  void measureInserts(const std::string& name, MakeKey makeKey)
+  {
+    for (size_t size = 1000; size <= 16000; size *= 4)
+    {
+      size_t heap_before = heapInUse();
+      Tree tree;
+      Clock::time_point start = Clock::now();
+      for (size_t i = 0; i < size; i++)
+      {
+        tree.emplace(makeKey((i * 2654435761u) % size), "value-" + std::to_string(i));
+      }
+      std::chrono::duration< double, std::nano > time = Clock::now() - start;
+      size_t heap = heapInUse() - heap_before;
+      BOOST_TEST(tree.size() == size);
+
+      std::cout << name << '\t' << sizeof(typename Tree::Node) << '\t' << size << '\t';
+      std::cout << static_cast< double >(heap) / size << '\t' << time.count() / size << '\n';
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(S4_tree_benchmark, *boost::unit_test::disabled())
+
+BOOST_AUTO_TEST_CASE(node_layout)
+{
+  std::cout << "keys\tnode bytes\tsize\theap bytes per element\tinsert ns\n";
+  using NumberTree = alymova::TwoThreeTree< size_t, std::string, std::less< size_t > >;
+  measureInserts< NumberTree >("size_t", [](size_t i)
+  {
+    return i;
+  });
+  using StringTree = alymova::TwoThreeTree< std::string, std::string, std::less< std::string > >;
+  measureInserts< StringTree >("string", [](size_t i)
+  {
+    return "key-" + std::to_string(i);
+  });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,4 +1,5 @@
 #include <boost/test/unit_test.hpp>
+#include <stdexcept>
 #include <tree/tree-2-3.hpp>
 
 BOOST_AUTO_TEST_CASE(test_constructors_operators)
@@ -448,3 +449,87 @@ BOOST_AUTO_TEST_CASE(test_erase)
   BOOST_TEST(tree.size() == 0);
   BOOST_TEST((it == tree.end()));
 }
+namespace
+{
+  struct Fragile
+  {
+    static int live;
+    int moves_left;
+
+    Fragile(int moves):
+      moves_left(moves)
+    {
+      live++;
+    }
+    Fragile(const Fragile& rhs):
+      moves_left(rhs.moves_left)
+    {
+      live++;
+    }
+    Fragile(Fragile&& rhs):
+      moves_left(rhs.moves_left - 1)
+    {
+      if (rhs.moves_left == 0)
+      {
+        throw std::runtime_error("move failed");
+      }
+      live++;
+    }
+    Fragile& operator=(const Fragile&) = default;
+    Fragile& operator=(Fragile&&) noexcept = default;
+    ~Fragile()
+    {
+      live--;
+    }
+  };
+  int Fragile::live = 0;
+}
+BOOST_AUTO_TEST_CASE(test_split_insert_exception)
+{
+  using Tree = alymova::TwoThreeTree< int, Fragile, std::less< int > >;
+
+  for (int size = 2; size <= 16; size++)
+  {
+    for (int key = 1; key <= 2 * size + 1; key += 2)
+    {
+      for (int moves = 0; moves < 6; moves++)
+      {
+        {
+          Tree tree;
+          for (int i = 1; i <= size; i++)
+          {
+            tree.emplace(2 * i, Fragile(100));
+          }
+          bool inserted = true;
+          try
+          {
+            tree.emplace(key, Fragile(moves));
+          }
+          catch (const std::runtime_error&)
+          {
+            inserted = false;
+          }
+          BOOST_TEST(tree.size() == static_cast< size_t >(size + inserted));
+          BOOST_TEST((tree.find(key) != tree.end()) == inserted);
+          int expected = 1;
+          for (auto it = tree.begin(); it != tree.end(); it++)
+          {
+            if (expected % 2 == 1 && !(inserted && expected == key))
+            {
+              expected++;
+            }
+            BOOST_TEST(it->first == expected);
+            expected++;
+          }
+          if (!inserted)
+          {
+            tree.emplace(1000, Fragile(100));
+            BOOST_TEST(tree.size() == static_cast< size_t >(size + 1));
+            BOOST_TEST((--tree.end())->first == 1000);
+          }
+        }
+        BOOST_TEST(Fragile::live == 0);
+      }
+    }
+  }
+}
@@ -21,9 +21,13 @@ void alymova::VertexesCommand::operator()(const GraphSet& graphs)
   {
     throw std::logic_error("<INVALID COMMAND>");
   }
-  List< std::string > copy_vertexes(it_name->second.vertexes);
-  copy_vertexes.sort();
-  out << copy_vertexes;
+  List< std::string > names;
+  for (auto it = it_name->second.vertexes.begin(); it != it_name->second.vertexes.end(); it++)
+  {
+    names.push_back(it->first);
+  }
+  names.sort();
+  out << names;
 }
 
 void alymova::OutboundCommand::operator()(const GraphSet& graphs)
@@ -130,6 +134,7 @@ void alymova::ExtractCommand::operator()(GraphSet& graphs)
   in >> vertexes_cnt;
 
   Graph graph_new;
+  List< std::string > extracted;
   std::string vertex;
   for (size_t i = 0; i < vertexes_cnt; i++)
   {
@@ -137,13 +142,21 @@ void alymova::ExtractCommand::operator()(GraphSet& graphs)
     {
       throw std::logic_error("<INVALID COMMAND>");
     }
-    graph_new.addVertex(vertex);
+    if (!graph_new.hasVertex(vertex))
+    {
+      graph_new.addVertex(vertex);
+      extracted.push_back(vertex);
+    }
   }
-  for (auto it = it_name->second.edges.begin(); it != it_name->second.edges.end(); it++)
+  for (auto it = extracted.begin(); it != extracted.end(); it++)
   {
-    if (graph_new.hasVertex(it->first.first) && graph_new.hasVertex(it->first.second))
+    const IncidentList& outbound = it_name->second.vertexes.at(*it).outbound;
+    for (auto it_out = outbound.begin(); it_out != outbound.end(); it_out++)
     {
-      graph_new.addEdge(it->first.first, it->first.second, it->second);
+      if (graph_new.hasVertex(it_out->first))
+      {
+        graph_new.addEdge(*it, it_out->first, it_out->second);
+      }
     }
   }
   graphs.insert(std::make_pair(name_new, graph_new));
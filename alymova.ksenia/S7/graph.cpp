@@ -3,42 +3,63 @@
 void alymova::Graph::addEdge(const std::string& vertex1, const std::string& vertex2, size_t weight)
 {
   edges.insert(std::make_pair(std::make_pair(vertex1, vertex2), weight));
-  addVertex(vertex1);
-  addVertex(vertex2);
+  getIncidence(vertex1).outbound.push_back(std::make_pair(vertex2, weight));
+  getIncidence(vertex2).inbound.push_back(std::make_pair(vertex1, weight));
 }
 
 void alymova::Graph::cutEdge(const std::string& vertex1, const std::string& vertex2, size_t weight)
 {
+  auto it_vertex1 = vertexes.find(vertex1);
+  auto it_vertex2 = vertexes.find(vertex2);
+  if (it_vertex1 == vertexes.end() || it_vertex2 == vertexes.end())
+  {
+    throw std::logic_error("<INVALID COMMAND>");
+  }
+  IncidentList& outbound = it_vertex1->second.outbound;
+  auto it_out = outbound.begin();
+  for (; it_out != outbound.end(); it_out++)
+  {
+    if (it_out->first == vertex2 && it_out->second == weight)
+    {
+      break;
+    }
+  }
+  if (it_out == outbound.end())
+  {
+    throw std::logic_error("<INVALID COMMAND>");
+  }
+  outbound.erase(it_out);
+
+  IncidentList& inbound = it_vertex2->second.inbound;
+  for (auto it_in = inbound.begin(); it_in != inbound.end(); it_in++)
+  {
+    if (it_in->first == vertex1 && it_in->second == weight)
+    {
+      inbound.erase(it_in);
+      break;
+    }
+  }
+
   std::pair< std::string, std::string > vertex_pair(vertex1, vertex2);
-  for (auto it = edges.begin(); it != edges.end(); it++)
+  auto range = edges.equal_range(vertex_pair);
+  for (auto it = range.first; it != range.second; it++)
   {
-    if (it->first == vertex_pair && it->second == weight)
+    if (it->second == weight)
     {
       edges.erase(it);
       return;
     }
   }
-  throw std::logic_error("<INVALID COMMAND>");
 }
 
 void alymova::Graph::addVertex(const std::string& vertex)
 {
-  if (!hasVertex(vertex))
-  {
-    vertexes.push_back(vertex);
-  }
+  getIncidence(vertex);
 }
 
 bool alymova::Graph::hasVertex(const std::string& vertex) const
 {
-  for (auto it = vertexes.begin(); it != vertexes.end(); it++)
-  {
-    if (*it == vertex)
-    {
-      return true;
-    }
-  }
-  return false;
+  return vertexes.find(vertex) != vertexes.end();
 }
 
 void alymova::Graph::merge(const Graph& other)
@@ -52,11 +73,13 @@ void alymova::Graph::merge(const Graph& other)
 alymova::BoundMap alymova::Graph::getOutbound(const std::string& vertex) const
 {
   BoundMap outbound;
-  for (auto it = edges.begin(); it != edges.end(); it++)
+  auto it_vertex = vertexes.find(vertex);
+  if (it_vertex != vertexes.end())
   {
-    if (it->first.first == vertex)
+    const IncidentList& incident = it_vertex->second.outbound;
+    for (auto it = incident.begin(); it != incident.end(); it++)
     {
-      outbound[it->first.second].push_back(it->second);
+      outbound[it->first].push_back(it->second);
     }
   }
   return outbound;
@@ -65,16 +88,29 @@ alymova::BoundMap alymova::Graph::getOutbound(const std::string& vertex) const
 alymova::BoundMap alymova::Graph::getInbound(const std::string& vertex) const
 {
   BoundMap inbound;
-  for (auto it = edges.begin(); it != edges.end(); it++)
+  auto it_vertex = vertexes.find(vertex);
+  if (it_vertex != vertexes.end())
   {
-    if (it->first.second == vertex)
+    const IncidentList& incident = it_vertex->second.inbound;
+    for (auto it = incident.begin(); it != incident.end(); it++)
     {
-      inbound[it->first.first].push_back(it->second);
+      inbound[it->first].push_back(it->second);
     }
   }
   return inbound;
 }
 
+alymova::Incidence& alymova::Graph::getIncidence(const std::string& vertex)
+{
+  auto it = vertexes.find(vertex);
+  if (it == vertexes.end())
+  {
+    vertexes.emplace(vertex, Incidence{});
+    it = vertexes.find(vertex);
+  }
+  return it->second;
+}
+
 std::istream& alymova::operator>>(std::istream& in, Graph& graph)
 {
   std::istream::sentry s(in);
@@ -12,11 +12,18 @@
 namespace alymova
 {
   using BoundMap = TwoThreeTree< std::string, List< size_t >, std::less< std::string > >;
+  using IncidentList = List< std::pair< std::string, size_t > >;
+
+  struct Incidence
+  {
+    IncidentList outbound;
+    IncidentList inbound;
+  };
 
   struct Graph
   {
     HashTable< std::pair< std::string, std::string >, size_t, PairHasher< std::string > > edges;
-    List< std::string > vertexes;
+    HashTable< std::string, Incidence, Hasher< std::string > > vertexes;
 
     void addEdge(const std::string& vertex1, const std::string& vertex2, size_t weight);
     void cutEdge(const std::string& vertex1, const std::string& vertex2, size_t weight);
@@ -25,6 +32,8 @@ namespace alymova
     BoundMap getOutbound(const std::string& vertex) const;
     BoundMap getInbound(const std::string& vertex) const;
     void merge(const Graph& other);
+  private:
+    Incidence& getIncidence(const std::string& vertex);
   };
 
   std::istream& operator>>(std::istream& in, Graph& graph);
@@ -50,6 +50,48 @@ namespace alymova
     friend class HashTable< Key, Value, Hash, KeyEqual >;
   };
 
+  template< class Key, class Value, class Hash = std::hash< Key >, class KeyEqual = std::equal_to< Key > >
+  struct HashRangeConstIterator:
+    public std::iterator< std::forward_iterator_tag, std::pair< Key, Value > >
+  {
+    using Node = detail::HashNode< Key, Value >;
+    using NodeState = typename HashTable< Key, Value, Hash, KeyEqual >::NodeState;
+    using T = std::pair< NodeState, Node >;
+
+    HashRangeConstIterator() = default;
+    HashRangeConstIterator& operator++() noexcept;
+    HashRangeConstIterator operator++(int) noexcept;
+    bool operator==(const HashRangeConstIterator& other) const noexcept;
+    bool operator!=(const HashRangeConstIterator& other) const noexcept;
+    const std::pair< Key, Value >& operator*() const noexcept;
+    const std::pair< Key, Value >* operator->() const noexcept;
+  protected:
+    T* node_;
+    T* begin_;
+    T* end_;
+
+    HashRangeConstIterator(T* node, T* begin, T* end) noexcept;
+
+    friend class HashTable< Key, Value, Hash, KeyEqual >;
+  };
+
+  template< class Key, class Value, class Hash = std::hash< Key >, class KeyEqual = std::equal_to< Key > >
+  struct HashRangeIterator final:
+    public HashRangeConstIterator< Key, Value, Hash, KeyEqual >
+  {
+    using Base = HashRangeConstIterator< Key, Value, Hash, KeyEqual >;
+    using Node = detail::HashNode< Key, Value >;
+    using NodeState = typename HashTable< Key, Value, Hash, KeyEqual >::NodeState;
+    using T = std::pair< NodeState, Node >;
+
+    std::pair< Key, Value >& operator*() noexcept;
+    std::pair< Key, Value >* operator->() noexcept;
+  private:
+    HashRangeIterator(T* node, T* begin, T* end) noexcept;
+
+    friend class HashTable< Key, Value, Hash, KeyEqual >;
+  };
+
   template< class Key, class Value, class Hash, class KeyEqual >
   HashConstIterator< Key, Value, Hash, KeyEqual >::HashConstIterator(T* node, T* end) noexcept:
     node_(node),
@@ -133,6 +175,85 @@ namespace alymova
 
     return std::addressof(Base::node_->second.data);
   }
+
+  template< class Key, class Value, class Hash, class KeyEqual >
+  HashRangeConstIterator< Key, Value, Hash, KeyEqual >::HashRangeConstIterator(T* node, T* begin, T* end) noexcept:
+    node_(node),
+    begin_(begin),
+    end_(end)
+  {}
+
+  template< class Key, class Value, class Hash, class KeyEqual >
+  HashRangeConstIterator< Key, Value, Hash, KeyEqual >&
+    HashRangeConstIterator< Key, Value, Hash, KeyEqual >::operator++() noexcept
+  {
+    node_++;
+    if (node_ == end_)
+    {
+      node_ = begin_;
+    }
+    return *this;
+  }
+
+  template< class Key, class Value, class Hash, class KeyEqual >
+  HashRangeConstIterator< Key, Value, Hash, KeyEqual >
+    HashRangeConstIterator< Key, Value, Hash, KeyEqual >::operator++(int) noexcept
+  {
+    HashRangeConstIterator old = *this;
+    ++(*this);
+    return old;
+  }
+
+  template< class Key, class Value, class Hash, class KeyEqual >
+  bool HashRangeConstIterator< Key, Value, Hash, KeyEqual >::operator==(const HashRangeConstIterator& other) const noexcept
+  {
+    return node_ == other.node_;
+  }
+
+  template< class Key, class Value, class Hash, class KeyEqual >
+  bool HashRangeConstIterator< Key, Value, Hash, KeyEqual >::operator!=(const HashRangeConstIterator& other) const noexcept
+  {
+    return !(*this == other);
+  }
+
+  template< class Key, class Value, class Hash, class KeyEqual >
+  const std::pair< Key, Value >&
+    HashRangeConstIterator< Key, Value, Hash, KeyEqual >::operator*() const noexcept
+  {
+    assert(node_->first != NodeState::Empty && "You try to dereference empty node");
+
+    return node_->second.data;
+  }
+
+  template< class Key, class Value, class Hash, class KeyEqual >
+  const std::pair< Key, Value >*
+    HashRangeConstIterator< Key, Value, Hash, KeyEqual >::operator->() const noexcept
+  {
+    assert(node_->first != NodeState::Empty && "You try to dereference empty node");
+
+    return std::addressof(node_->second.data);
+  }
+
+  template< class Key, class Value, class Hash, class KeyEqual >
+  HashRangeIterator< Key, Value, Hash, KeyEqual >::HashRangeIterator(T* node, T* begin, T* end) noexcept:
+    Base(node, begin, end)
+  {}
+
+  template< class Key, class Value, class Hash, class KeyEqual >
+  std::pair< Key, Value >& HashRangeIterator< Key, Value, Hash, KeyEqual >::operator*() noexcept
+  {
+    assert(Base::node_->first != NodeState::Empty && "You try to dereference empty node");
+
+    return Base::node_->second.data;
+  }
+
+  template< class Key, class Value, class Hash, class KeyEqual >
+  std::pair< Key, Value >* HashRangeIterator< Key, Value, Hash, KeyEqual >::operator->() noexcept
+  {
+    assert(Base::node_->first != NodeState::Empty && "You try to dereference empty node");
+
+    return std::addressof(Base::node_->second.data);
+  }
 }
 
 #endif
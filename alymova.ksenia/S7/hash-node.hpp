@@ -11,6 +11,7 @@ namespace alymova
     struct HashNode
     {
       std::pair< Key, Value > data;
+      size_t hash;
       size_t psl;
 
       const Key& get_key() const noexcept;
@@ -27,6 +28,7 @@ namespace alymova
     void HashNode< Key, Value >::swap(HashNode< Key, Value >& other)
     {
       std::swap(data, other.data);
+      std::swap(hash, other.hash);
       std::swap(psl, other.psl);
     }
   }
@@ -15,6 +15,8 @@ namespace alymova
     using Hashtable = HashTable< Key, Value, Hash, KeyEqual >;
     using Iterator = HashIterator< Key, Value, Hash, KeyEqual >;
     using ConstIterator = HashConstIterator< Key, Value, Hash, KeyEqual >;
+    using RangeIterator = HashRangeIterator< Key, Value, Hash, KeyEqual >;
+    using ConstRangeIterator = HashRangeConstIterator< Key, Value, Hash, KeyEqual >;
     using Node = detail::HashNode< Key, Value >;
     using ValueType = std::pair< Key, Value >;
 
@@ -53,12 +55,15 @@ namespace alymova
     size_t erase(const Key& key);
     Iterator erase(Iterator pos);
     Iterator erase(ConstIterator pos);
+    Iterator erase(ConstRangeIterator pos);
     Iterator erase(ConstIterator first, ConstIterator last);
 
     Value& at(const Key& key);
     const Value& at(const Key& key) const;
     Iterator find(const Key& key);
     ConstIterator find(const Key& key) const;
+    std::pair< RangeIterator, RangeIterator > equal_range(const Key& key);
+    std::pair< ConstRangeIterator, ConstRangeIterator > equal_range(const Key& key) const;
 
     void clear() noexcept;
     void swap(HashTable& other);
@@ -78,14 +83,17 @@ namespace alymova
     Hash hasher_;
     KeyEqual equal_;
 
-    size_t get_home_index(const Key& key) const noexcept;
-    std::pair< size_t, T > rob_rich(size_t home_index, const Node& value);
-    Iterator insert_node(size_t index, const Node& node);
+    bool is_match(size_t index, const Key& key, size_t hash) const;
+    size_t find_index(const Key& key, size_t hash) const;
+    Iterator insert_node(Node node);
+    void erase_index(size_t index) noexcept;
     size_t get_next_prime_capacity() const noexcept;
     void clear_default() noexcept;
 
     friend class HashConstIterator< Key, Value, Hash, KeyEqual >;
     friend class HashIterator< Key, Value, Hash, KeyEqual >;
+    friend class HashRangeConstIterator< Key, Value, Hash, KeyEqual >;
+    friend class HashRangeIterator< Key, Value, Hash, KeyEqual >;
   };
 
   template< class Key, class Value, class Hash, class KeyEqual >
@@ -260,15 +268,13 @@ namespace alymova
   HashIterator< Key, Value, Hash, KeyEqual > HashTable< Key, Value, Hash, KeyEqual >::emplace(Args&&... args)
   {
     ValueType value(std::forward< Args >(args)...);
-    size_t home_index = get_home_index(value.first);
-    Node node{value, 0};
-    Iterator res = insert_node(home_index, node);
-    size_++;
-    if (size_ > max_load_factor_ * capacity_)
+    if (size_ >= capacity_ || size_ + 1 > max_load_factor_ * capacity_)
     {
       rehash();
-      return find(value.first);
     }
+    size_t hash = hasher_(value.first);
+    Iterator res = insert_node(Node{std::move(value), hash, 0});
+    size_++;
     return res;
   }
 
@@ -296,9 +302,18 @@ namespace alymova
   size_t HashTable< Key, Value, Hash, KeyEqual >::erase(const Key& key)
   {
     size_t size_old = size_;
-    while (find(key) != end())
+    size_t hash = hasher_(key);
+    size_t index = hash % capacity_;
+    size_t psl = 0;
+    while (array_[index].first == NodeState::Fill && array_[index].second.psl >= psl)
     {
-      erase(find(key));
+      if (is_match(index, key, hash))
+      {
+        erase_index(index);
+        continue;
+      }
+      index = (index + 1) % capacity_;
+      psl++;
     }
     return size_old - size_;
   }
@@ -309,28 +324,11 @@ namespace alymova
     assert(size_ != 0 && "You try to delete from empty container");
     assert(pos != end() && "You try to delete beyond table's bound");
 
-    pos.node_->first = NodeState::Empty;
-    size_t i = (pos.node_ - array_ + 1) % capacity_;
-    while (array_[i].first != NodeState::Empty)
-    {
-      if (array_[i].second.psl == 0)
-      {
-        break;
-      }
-      size_t prev = i - 1;
-      if (i == 0)
-      {
-        prev = capacity_ - 1;
-      }
-      array_[i].second.psl--;
-      std::swap(array_[i], array_[prev]);
-      i = (i + 1) % capacity_;
-    }
+    erase_index(pos.node_ - array_);
     if (pos.node_->first == NodeState::Empty)
     {
       pos++;
     }
-    size_--;
     return pos;
   }
 
@@ -342,6 +340,14 @@ namespace alymova
     return erase(it);
   }
 
+  template< class Key, class Value, class Hash, class KeyEqual >
+  HashIterator< Key, Value, Hash, KeyEqual >
+    HashTable< Key, Value, Hash, KeyEqual >::erase(ConstRangeIterator pos)
+  {
+    Iterator it(pos.node_, pos.end_);
+    return erase(it);
+  }
+
   template< class Key, class Value, class Hash, class KeyEqual >
   HashIterator< Key, Value, Hash, KeyEqual >
     HashTable< Key, Value, Hash, KeyEqual >::erase(ConstIterator first, ConstIterator last)
@@ -382,33 +388,36 @@ namespace alymova
   HashConstIterator< Key, Value, Hash, KeyEqual >
     HashTable< Key, Value, Hash, KeyEqual >::find(const Key& key) const
   {
-    size_t home_index = get_home_index(key);
-    if (array_[home_index].first == NodeState::Empty)
+    return ConstIterator{array_ + find_index(key, hasher_(key)), array_ + capacity_};
+  }
+
+  template< class Key, class Value, class Hash, class KeyEqual >
+  std::pair< HashRangeIterator< Key, Value, Hash, KeyEqual >, HashRangeIterator< Key, Value, Hash, KeyEqual > >
+    HashTable< Key, Value, Hash, KeyEqual >::equal_range(const Key& key)
+  {
+    std::pair< ConstRangeIterator, ConstRangeIterator > range = static_cast< const HashTable& >(*this).equal_range(key);
+    RangeIterator first{range.first.node_, range.first.begin_, range.first.end_};
+    RangeIterator last{range.second.node_, range.second.begin_, range.second.end_};
+    return {first, last};
+  }
+
+  template< class Key, class Value, class Hash, class KeyEqual >
+  std::pair< HashRangeConstIterator< Key, Value, Hash, KeyEqual >, HashRangeConstIterator< Key, Value, Hash, KeyEqual > >
+    HashTable< Key, Value, Hash, KeyEqual >::equal_range(const Key& key) const
+  {
+    size_t hash = hasher_(key);
+    size_t first = find_index(key, hash);
+    T* table_end = array_ + capacity_;
+    if (first == capacity_)
     {
-      return end();
+      return {ConstRangeIterator{array_, array_, table_end}, ConstRangeIterator{array_, array_, table_end}};
     }
-    if (equal_(array_[home_index].second.get_key(), key))
+    size_t last = (first + 1) % capacity_;
+    while (array_[last].first == NodeState::Fill && is_match(last, key, hash))
     {
-      return ConstIterator{array_ + home_index, array_ + capacity_};
+      last = (last + 1) % capacity_;
     }
-    size_t psl = 1;
-    for (size_t i = (home_index + 1) % capacity_; i != home_index; i = (i + 1) % capacity_)
-    {
-      if (array_[i].first == NodeState::Empty)
-      {
-        return end();
-      }
-      if (array_[i].second.psl < psl)
-      {
-        return end();
-      }
-      if (equal_(array_[i].second.get_key(), key))
-      {
-        return ConstIterator{array_ + i, array_ + capacity_};
-      }
-      psl++;
-    }
-    return end();
+    return {ConstRangeIterator{array_ + first, array_, table_end}, ConstRangeIterator{array_ + last, array_, table_end}};
   }
 
   template< class Key, class Value, class Hash, class KeyEqual >
@@ -454,88 +463,113 @@ namespace alymova
   void HashTable< Key, Value, Hash, KeyEqual >::rehash()
   {
     size_t capacity_old = capacity_;
+    size_t size_old = size_;
+    T* array_old = array_;
+    array_ = new T[get_next_prime_capacity()];
     capacity_ = get_next_prime_capacity();
-    T* array_new = nullptr;
+    clear();
     try
     {
-      array_new = new T[capacity_];
-      std::swap(array_new, array_);
-      clear();
       for (size_t i = 0; i < capacity_old; i++)
       {
-        if (array_new[i].first == NodeState::Fill)
+        if (array_old[i].first == NodeState::Fill)
         {
-          insert(array_new[i].second.data);
+          insert_node(std::move_if_noexcept(array_old[i].second));
+          size_++;
         }
       }
-      delete[] array_new;
     }
     catch (...)
     {
-      delete[] array_new;
+      delete[] array_;
+      array_ = array_old;
       capacity_ = capacity_old;
+      size_ = size_old;
       throw;
     }
+    delete[] array_old;
   }
 
   template< class Key, class Value, class Hash, class KeyEqual >
-  size_t HashTable< Key, Value, Hash, KeyEqual >::get_home_index(const Key& key) const noexcept
+  bool HashTable< Key, Value, Hash, KeyEqual >::is_match(size_t index, const Key& key, size_t hash) const
   {
-    return hasher_(key) % capacity_;
+    return array_[index].second.hash == hash && equal_(array_[index].second.get_key(), key);
   }
 
   template< class Key, class Value, class Hash, class KeyEqual >
-  std::pair< size_t, typename HashTable< Key, Value, Hash, KeyEqual >::T >
-    HashTable< Key, Value, Hash, KeyEqual >::rob_rich(size_t home_index, const Node& node)
+  size_t HashTable< Key, Value, Hash, KeyEqual >::find_index(const Key& key, size_t hash) const
   {
-    std::pair< NodeState, Node > node_t{NodeState::Fill, node};
-    node_t.second.psl++;
-    for (size_t i = (home_index + 1) % capacity_; i != home_index; i = (i + 1) % capacity_)
+    size_t index = hash % capacity_;
+    size_t psl = 0;
+    while (array_[index].first == NodeState::Fill && array_[index].second.psl >= psl)
     {
-      if (array_[i].first == NodeState::Empty)
-      {
-        node_t.swap(array_[i]);
-        return {i, node_t};
-      }
-      if (node_t.second.psl > array_[i].second.psl)
+      if (is_match(index, key, hash))
       {
-        node_t.swap(array_[i]);
-        return {i, node_t};
+        return index;
       }
-      node_t.second.psl++;
+      index = (index + 1) % capacity_;
+      psl++;
     }
-    return {home_index, node_t};
+    return capacity_;
   }
 
   template< class Key, class Value, class Hash, class KeyEqual >
-  HashIterator< Key, Value, Hash, KeyEqual >
-    HashTable< Key, Value, Hash, KeyEqual >::insert_node(size_t index, const Node& node)
+  HashIterator< Key, Value, Hash, KeyEqual > HashTable< Key, Value, Hash, KeyEqual >::insert_node(Node node)
   {
-    size_t home_index;
-    if (index < node.psl)
+    T current{NodeState::Fill, std::move(node)};
+    current.second.psl = 0;
+    size_t index = current.second.hash % capacity_;
+    size_t inserted = capacity_;
+    bool after_equal = false;
+    while (array_[index].first == NodeState::Fill)
     {
-      home_index = capacity_ - node.psl;
-    }
-    else
-    {
-      home_index = index - node.psl;
+      bool equal = is_match(index, current.second.get_key(), current.second.hash);
+      if (!equal && (current.second.psl > array_[index].second.psl || after_equal))
+      {
+        current.swap(array_[index]);
+        if (inserted == capacity_)
+        {
+          inserted = index;
+        }
+        // the displaced node heads its run of equal keys: put it back right after that run
+        after_equal = true;
+      }
+      else
+      {
+        after_equal = equal;
+      }
+      index = (index + 1) % capacity_;
+      current.second.psl++;
     }
-    if (array_[home_index].first == NodeState::Empty)
+    array_[index] = std::move(current);
+    if (inserted == capacity_)
     {
-      array_[home_index].first = NodeState::Fill;
-      array_[home_index].second = node;
-      return Iterator{array_ + home_index, array_ + capacity_};
+      inserted = index;
     }
-    std::pair< size_t, T > rob_res = rob_rich(home_index, node);
-    if (rob_res.first == home_index)
-    {
-      rehash();
-    }
-    if (rob_res.second.first == NodeState::Fill)
+    return Iterator{array_ + inserted, array_ + capacity_};
+  }
+
+  template< class Key, class Value, class Hash, class KeyEqual >
+  void HashTable< Key, Value, Hash, KeyEqual >::erase_index(size_t index) noexcept
+  {
+    array_[index].first = NodeState::Empty;
+    size_t i = (index + 1) % capacity_;
+    while (array_[i].first != NodeState::Empty)
     {
-      return insert_node(rob_res.first, rob_res.second.second);
+      if (array_[i].second.psl == 0)
+      {
+        break;
+      }
+      size_t prev = i - 1;
+      if (i == 0)
+      {
+        prev = capacity_ - 1;
+      }
+      array_[i].second.psl--;
+      std::swap(array_[i], array_[prev]);
+      i = (i + 1) % capacity_;
     }
-    return Iterator{array_ + rob_res.first, array_ + capacity_};
+    size_--;
   }
 
   template< class Key, class Value, class Hash, class KeyEqual >
@@ -0,0 +1,117 @@
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "graph.hpp"
+#include "hash-table.hpp"
+
+namespace
+{
+  using Clock = std::chrono::steady_clock;
+
+  std::string makeDescription(size_t vertexes, size_t edges)
+  {
+    std::ostringstream out;
+    out << edges << '\n';
+    size_t state = 12345;
+    for (size_t i = 0; i < edges; i++)
+    {
+      state = state * 6364136223846793005ull + 1442695040888963407ull;
+      size_t from = (state >> 33) % vertexes;
+      size_t to = (state >> 13) % vertexes;
+      out << 'v' << from << " v" << to << ' ' << (state >> 50) % 100 << '\n';
+    }
+    return out.str();
+  }
+
+  double nsPerOp(Clock::time_point start, size_t ops)
+  {
+    std::chrono::duration< double, std::nano > time = Clock::now() - start;
+    return time.count() / ops;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(S7_graph_benchmark, *boost::unit_test::disabled())
+
+BOOST_AUTO_TEST_CASE(load_and_bounds)
+{
+  std::cout << "vertexes\tedges\tload ms\tbound queries\tquery us\n";
+  const size_t sizes[][2] = {{1000, 100000}, {10000, 100000}, {100000, 1000000}};
+  for (auto size: sizes)
+  {
+    std::istringstream in(makeDescription(size[0], size[1]));
+    alymova::Graph graph;
+
+    Clock::time_point start = Clock::now();
+    in >> graph;
+    std::chrono::duration< double, std::milli > load = Clock::now() - start;
+    BOOST_TEST(graph.edges.size() == size[1]);
+
+    const size_t queries = 1000;
+    size_t bounds = 0;
+    start = Clock::now();
+    for (size_t i = 0; i < queries; i++)
+    {
+      std::string vertex = 'v' + std::to_string(i * 7919 % size[0]);
+      bounds += graph.getOutbound(vertex).size() + graph.getInbound(vertex).size();
+    }
+    std::chrono::duration< double, std::micro > query = Clock::now() - start;
+    BOOST_TEST(bounds > 0);
+
+    std::cout << size[0] << '\t' << size[1] << '\t' << load.count() << '\t';
+    std::cout << queries << '\t' << query.count() / queries << '\n';
+  }
+}
+
+BOOST_AUTO_TEST_CASE(string_keys)
+{
+  std::cout << "keys\tinsert ns\thit ns\tmiss ns\terase ns\n";
+  for (size_t size = 1000; size <= 1000000; size *= 10)
+  {
+    std::vector< std::string > keys;
+    std::vector< std::string > missing;
+    for (size_t i = 0; i < size; i++)
+    {
+      keys.push_back("vertex-" + std::to_string(i * 2654435761u));
+      missing.push_back("vertex-" + std::to_string((i + size) * 2654435761u));
+    }
+    alymova::HashTable< std::string, size_t, alymova::Hasher< std::string > > table;
+
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < size; i++)
+    {
+      table.emplace(keys[i], i);
+    }
+    double insert = nsPerOp(start, size);
+
+    size_t found = 0;
+    start = Clock::now();
+    for (size_t i = 0; i < size; i++)
+    {
+      found += table.find(keys[i]) != table.end();
+    }
+    double hit = nsPerOp(start, size);
+
+    start = Clock::now();
+    for (size_t i = 0; i < size; i++)
+    {
+      found += table.find(missing[i]) != table.end();
+    }
+    double miss = nsPerOp(start, size);
+
+    start = Clock::now();
+    for (size_t i = 0; i < size; i++)
+    {
+      found -= table.erase(keys[i]);
+    }
+    double erase = nsPerOp(start, size);
+    BOOST_TEST(found == 0);
+    BOOST_TEST(table.empty());
+
+    std::cout << size << '\t' << insert << '\t' << hit << '\t' << miss << '\t' << erase << '\n';
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,66 @@
+#include <boost/test/unit_test.hpp>
+#include <sstream>
+#include <stdexcept>
+#include "graph.hpp"
+
+BOOST_AUTO_TEST_CASE(test_graph_incidence)
+{
+  alymova::Graph graph;
+  graph.addEdge("a", "b", 1);
+  graph.addEdge("a", "b", 3);
+  graph.addEdge("a", "c", 2);
+  graph.addEdge("c", "a", 5);
+  graph.addEdge("b", "b", 4);
+  graph.addVertex("d");
+
+  BOOST_TEST(graph.hasVertex("a"));
+  BOOST_TEST(graph.hasVertex("d"));
+  BOOST_TEST(!graph.hasVertex("e"));
+  BOOST_TEST(graph.vertexes.size() == 4);
+  BOOST_TEST(graph.edges.size() == 5);
+
+  std::ostringstream out;
+  out << graph.getOutbound("a");
+  BOOST_TEST(out.str() == "b 1 3\nc 2");
+  out.str("");
+  out << graph.getInbound("b");
+  BOOST_TEST(out.str() == "a 1 3\nb 4");
+  out.str("");
+  out << graph.getInbound("a");
+  BOOST_TEST(out.str() == "c 5");
+  BOOST_TEST(graph.getOutbound("d").empty());
+  BOOST_TEST(graph.getOutbound("e").empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_graph_cut_merge)
+{
+  alymova::Graph graph;
+  graph.addEdge("a", "b", 1);
+  graph.addEdge("a", "b", 1);
+  graph.addEdge("b", "c", 2);
+
+  graph.cutEdge("a", "b", 1);
+  BOOST_TEST(graph.edges.size() == 2);
+  std::ostringstream out;
+  out << graph.getOutbound("a");
+  BOOST_TEST(out.str() == "b 1");
+  BOOST_CHECK_THROW(graph.cutEdge("a", "b", 2), std::logic_error);
+  BOOST_CHECK_THROW(graph.cutEdge("x", "b", 1), std::logic_error);
+  graph.cutEdge("a", "b", 1);
+  BOOST_TEST(graph.getOutbound("a").empty());
+  BOOST_TEST(graph.getInbound("b").empty());
+  BOOST_TEST(graph.hasVertex("a"));
+
+  alymova::Graph other;
+  std::istringstream in("2\nc a 7\nd b 8");
+  in >> other;
+  BOOST_TEST(other.edges.size() == 2);
+  graph.merge(other);
+  BOOST_TEST(graph.edges.size() == 3);
+  out.str("");
+  out << graph.getInbound("b");
+  BOOST_TEST(out.str() == "d 8");
+  out.str("");
+  out << graph.getOutbound("c");
+  BOOST_TEST(out.str() == "a 7");
+}
@@ -1,7 +1,32 @@
 #include <boost/test/unit_test.hpp>
 #include <exception>
+#include <iterator>
 #include "hash-table.hpp"
 
+namespace
+{
+  size_t hash_calls = 0;
+  size_t equal_calls = 0;
+
+  struct CountingHash
+  {
+    size_t operator()(int key) const
+    {
+      hash_calls++;
+      return key;
+    }
+  };
+
+  struct CountingEqual
+  {
+    bool operator()(int lhs, int rhs) const
+    {
+      equal_calls++;
+      return lhs == rhs;
+    }
+  };
+}
+
 BOOST_AUTO_TEST_CASE(test_constructors_operators)
 {
   using Map = alymova::HashTable< int, std::string >;
@@ -246,3 +271,120 @@ BOOST_AUTO_TEST_CASE(test_erase)
   BOOST_TEST(table1.empty());
   BOOST_TEST((it == table1.end()));
 }
+BOOST_AUTO_TEST_CASE(test_equal_range)
+{
+  using Map = alymova::HashTable< int, std::string >;
+
+  Map table1;
+  auto range = table1.equal_range(10);
+  BOOST_TEST((range.first == range.second));
+
+  table1.emplace(10, "aaa");
+  table1.emplace(21, "bbb");
+  table1.emplace(10, "ccc");
+  table1.emplace(10, "ddd");
+  range = table1.equal_range(10);
+  size_t cnt = 0;
+  for (auto it = range.first; it != range.second; it++)
+  {
+    BOOST_TEST(it->first == 10);
+    cnt++;
+  }
+  BOOST_TEST(cnt == 3);
+
+  const Map& table2 = table1;
+  auto const_range = table2.equal_range(21);
+  BOOST_TEST(const_range.first->second == "bbb");
+  const_range.first++;
+  BOOST_TEST((const_range.first == const_range.second));
+
+  cnt = table1.erase(10);
+  BOOST_TEST(cnt == 3);
+  BOOST_TEST(table1.size() == 1);
+  BOOST_TEST((table1.find(10) == table1.end()));
+  BOOST_TEST(table1.find(21)->second == "bbb");
+}
+
+BOOST_AUTO_TEST_CASE(test_equal_range_iterators)
+{
+  using Map = alymova::HashTable< int, std::string >;
+
+  Map table1;
+  table1.emplace(10, "aaa");
+  table1.emplace(10, "bbb");
+  table1.emplace(21, "ccc");
+  auto range = table1.equal_range(10);
+  BOOST_TEST(std::distance(range.first, range.second) == 2);
+  auto it = range.first;
+  it++;
+  BOOST_TEST((it != range.second));
+  BOOST_TEST(it->first == 10);
+  ++it;
+  BOOST_TEST((it == range.second));
+  BOOST_TEST(it->first == 21);
+
+  range.first->second = "ddd";
+  BOOST_TEST(table1.find(10)->second == "ddd");
+  table1.erase(range.first);
+  BOOST_TEST(table1.size() == 2);
+  range = table1.equal_range(10);
+  BOOST_TEST(std::distance(range.first, range.second) == 1);
+  BOOST_TEST(range.first->second == "bbb");
+
+  range = table1.equal_range(32);
+  BOOST_TEST((range.first == range.second));
+}
+
+BOOST_AUTO_TEST_CASE(test_equal_range_home_collision)
+{
+  using Map = alymova::HashTable< int, int >;
+
+  Map table1;
+  table1.emplace(1, 10);
+  table1.emplace(1, 11);
+  table1.emplace(12, 20);
+  table1.emplace(0, 0);
+  table1.emplace(0, 1);
+  table1.emplace(12, 21);
+  table1.emplace(1, 12);
+
+  for (int key: {1, 12, 0})
+  {
+    auto range = table1.equal_range(key);
+    size_t cnt = 0;
+    for (auto it = range.first; it != range.second; it++)
+    {
+      BOOST_TEST(it->first == key);
+      cnt++;
+    }
+    BOOST_TEST(cnt == (key == 1 ? 3 : 2));
+  }
+
+  table1.erase(table1.equal_range(1).first);
+  BOOST_TEST(std::distance(table1.equal_range(1).first, table1.equal_range(1).second) == 2);
+  BOOST_TEST(table1.erase(12) == 2);
+  BOOST_TEST(table1.size() == 4);
+}
+
+BOOST_AUTO_TEST_CASE(test_stored_hash)
+{
+  using Map = alymova::HashTable< int, int, CountingHash, CountingEqual >;
+
+  Map table1;
+  hash_calls = 0;
+  for (int i = 0; i < 100; i++)
+  {
+    table1.emplace(i, i);
+  }
+  BOOST_TEST(table1.size() == 100);
+  BOOST_TEST(hash_calls == 100);
+
+  hash_calls = 0;
+  equal_calls = 0;
+  for (int i = 0; i < 100; i++)
+  {
+    BOOST_TEST(table1.find(i)->second == i);
+  }
+  BOOST_TEST(hash_calls == 100);
+  BOOST_TEST(equal_calls == 100);
+}
@@ -221,9 +221,8 @@ namespace alymova
   List< T >& List< T >::operator=(List< T >&& other) noexcept
   {
     assert(this != std::addressof(other) && "Assigning a list to itself");
-    clear();
-    fake_ = std::exchange(other.fake_, nullptr);
-    head_ = std::exchange(other.head_, nullptr);
+    List< T > moved(std::move(other));
+    swap(moved);
     return *this;
   }
 
@@ -4,6 +4,8 @@
 #include <cassert>
 #include <functional>
 #include <exception>
+#include <type_traits>
+#include <utility>
 #include "tree-iterators.hpp"
 #include "tree-iterator-impl.hpp"
 #include "tree-const-iterator-impl.hpp"
@@ -27,6 +29,7 @@ namespace alymova
 
     using Node = typename detail::TTTNode< Key, Value, Comparator >;
     using NodeType = typename Node::NodeType;
+    using OverflowBuffer = typename Node::OverflowBuffer;
     using NodePoint = typename detail::NodePoint;
     using T = std::pair< Key, Value >;
 
@@ -116,7 +119,7 @@ namespace alymova
 
     void clear(Node* node) noexcept;
     void move_fake() const noexcept;
-    void split_insert(Node* node);
+    void split_insert(Node* node, OverflowBuffer& overflow, size_t point);
     Node* find_to_insert(const Key& key) const;
     Node* find_to_insert(ConstIterator hint) const noexcept;
     bool check_hint(ConstIterator hint, const Key& key) const;
@@ -240,7 +243,7 @@ namespace alymova
     auto it = lower_bound(key);
     if (it == end() || it->first != key)
     {
-      return insert(it, {key, Value()})->second;
+      return emplace_hint(it, key, Value())->second;
     }
     return (it->second);
   }
@@ -474,10 +477,10 @@ namespace alymova
   std::pair< TTTIterator< Key, Value, Comparator >, bool >
     TwoThreeTree< Key, Value, Comparator >::emplace(Args&&... args)
   {
-    std::pair< Key, Value > value(std::forward< Args >(args)...);
+    T value(std::forward< Args >(args)...);
     size_t size_before = size_;
     ConstIterator hint = lower_bound(value.first);
-    Iterator it = emplace_hint(hint, value);
+    Iterator it = emplace_hint(hint, std::move(value));
     if (size_before == size())
     {
       return {it, false};
@@ -490,7 +493,7 @@ namespace alymova
   TTTIterator< Key, Value, Comparator >
     TwoThreeTree< Key, Value, Comparator >::emplace_hint(ConstIterator hint, Args&&... args)
   {
-    std::pair< Key, Value > value(std::forward< Args >(args)...);
+    T value(std::forward< Args >(args)...);
     Iterator it_value = find(value.first);
     if (it_value != end())
     {
@@ -503,13 +506,15 @@ namespace alymova
     }
     if (size_ == 0)
     {
-      root_ = new Node{{}, NodeType::Empty, nullptr, nullptr, nullptr, nullptr, nullptr};
+      root_ = new Node;
       to_insert = root_;
     }
+    Key key = value.first;
+    OverflowBuffer overflow{};
+    size_t point = 0;
     try
     {
-      to_insert->insert(value);
-      split_insert(to_insert);
+      point = to_insert->emplace(overflow, std::move(value));
     }
     catch(...)
     {
@@ -520,9 +525,18 @@ namespace alymova
       }
       throw;
     }
+    try
+    {
+      split_insert(to_insert, overflow, point);
+    }
+    catch (...)
+    {
+      overflow.data[0].~T();
+      throw;
+    }
     size_++;
     move_fake();
-    return find(value.first);
+    return find(key);
   }
 
   template< class Key, class Value, class Comparator >
@@ -568,7 +582,11 @@ namespace alymova
   template< class Key, class Value, class Comparator >
   TTTIterator< Key, Value, Comparator > TwoThreeTree< Key, Value, Comparator >::erase(Iterator first, Iterator last)
   {
-    Key key_last = last->first;
+    Key key_last;
+    if (last != end())
+    {
+      key_last = last->first;
+    }
     while (first != last)
     {
       first = erase(first);
@@ -699,80 +717,119 @@ namespace alymova
   }
 
   template< class Key, class Value, class Comparator >
-  void TwoThreeTree< Key, Value, Comparator >::split_insert(Node* node)
+  void TwoThreeTree< Key, Value, Comparator >::split_insert(Node* node, OverflowBuffer& overflow, size_t point)
   {
     if (node->type != NodeType::Overflow)
     {
       return;
     }
-    Node* left = nullptr, *right = nullptr, *parent = nullptr;
+    Node* left = nullptr, *right = nullptr, *parent = node->parent;
+    OverflowBuffer up{};
+    size_t middle = 0;
     try
     {
-      parent = node->parent;
       if (!parent)
       {
-        parent = new Node{{}, NodeType::Empty, nullptr, nullptr, nullptr, nullptr, nullptr};
-        root_ = parent;
+        parent = new Node;
       }
-      left = new Node{{node->data[0]}, NodeType::Double, parent, node->left, nullptr, node->mid, nullptr};
-      right = new Node{{node->data[2]}, NodeType::Double, parent, node->right, nullptr, node->overflow, nullptr};
-      if (left->left && left->left != fake_left_)
+      left = new Node(parent, node->left, node->mid);
+      right = new Node(parent, node->right, overflow.child);
+      left->insert(T(std::move_if_noexcept(node->data[0])));
+      right->insert(T(std::move_if_noexcept(overflow.data[0])));
+      middle = parent->emplace(up, T(std::move_if_noexcept(node->data[1])));
+    }
+    catch (...)
+    {
+      delete left;
+      delete right;
+      if (parent != node->parent)
       {
-        left->left->parent = left;
-        left->right->parent = left;
-        right->left->parent = right;
-        right->right->parent = right;
+        delete parent;
       }
-      if (right->left == fake_right_)
+      node->unsettle(overflow, point);
+      throw;
+    }
+    Node* old_left = parent->left, *old_mid = parent->mid, *old_right = parent->right;
+    bool internal = left->left && left->left != fake_left_;
+    if (internal)
+    {
+      left->left->parent = left;
+      left->right->parent = left;
+      right->left->parent = right;
+      right->right->parent = right;
+    }
+    if (right->left == fake_right_)
+    {
+      right->left = nullptr;
+    }
+    if (parent->type == NodeType::Double)
+    {
+      parent->left = left;
+      parent->right = right;
+    }
+    else if (parent->right == node && parent->type == NodeType::Triple)
+    {
+      parent->mid = left;
+      parent->right = right;
+    }
+    else if (parent->right == node && parent->type == NodeType::Overflow)
+    {
+      parent->right = left;
+      up.child = right;
+    }
+    else if (parent->left == node && parent->type == NodeType::Triple)
+    {
+      parent->left = left;
+      parent->mid = right;
+    }
+    else if (parent->left == node && parent->type == NodeType::Overflow)
+    {
+      up.child = parent->right;
+      parent->right = parent->mid;
+      parent->mid = right;
+      parent->left = left;
+    }
+    else if (parent->mid == node)
+    {
+      up.child = parent->right;
+      parent->mid = left;
+      parent->right = right;
+    }
+    try
+    {
+      split_insert(parent, up, middle);
+    }
+    catch (...)
+    {
+      // parent is a Triple again and handed the middle value back in up: put node back in its place
+      parent->left = old_left;
+      parent->mid = old_mid;
+      parent->right = old_right;
+      if (internal)
       {
-        right->left = nullptr;
+        node->left->parent = node;
+        node->mid->parent = node;
+        node->right->parent = node;
+        overflow.child->parent = node;
       }
-      parent->insert(node->data[1]);
+      if (std::is_nothrow_move_constructible< T >::value)
       {
-        if (parent->type == NodeType::Double)
-        {
-          parent->left = left;
-          parent->right = right;
-        }
-        else if (parent->right == node && parent->type == NodeType::Triple)
-        {
-          parent->mid = left;
-          parent->right = right;
-        }
-        else if (parent->right == node && parent->type == NodeType::Overflow)
-        {
-          parent->right = left;
-          parent->overflow = right;
-        }
-        else if (parent->left == node && parent->type == NodeType::Triple)
-        {
-          parent->left = left;
-          parent->mid = right;
-        }
-        else if (parent->left == node && parent->type == NodeType::Overflow)
-        {
-          parent->overflow = parent->right;
-          parent->right = parent->mid;
-          parent->mid = right;
-          parent->left = left;
-        }
-        else if (parent->mid == node)
-        {
-          parent->overflow = parent->right;
-          parent->mid = left;
-          parent->right = right;
-        }
+        node->data[0] = std::move(left->data[0]);
+        node->data[1] = std::move(up.data[0]);
+        overflow.data[0] = std::move(right->data[0]);
       }
-    }
-    catch (...)
-    {
+      up.data[0].~T();
       delete left;
       delete right;
-      delete parent;
+      node->unsettle(overflow, point);
       throw;
     }
+    if (!node->parent)
+    {
+      root_ = parent;
+    }
+    overflow.data[0].~T();
     delete node;
-    split_insert(parent);
   }
 
   template< class Key, class Value, class Comparator >
@@ -1,5 +1,9 @@
 #ifndef TREE_NODE_HPP
 #define TREE_NODE_HPP
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
 #include <utility>
 #include "tree-iterators.hpp"
 
@@ -9,53 +13,157 @@ namespace alymova
   {
     enum NodePoint: int {Empty, First, Second, Fake};
 
+    template< class T, size_t N >
+    class RawValues
+    {
+    public:
+      T& operator[](size_t i) noexcept;
+      const T& operator[](size_t i) const noexcept;
+    private:
+      alignas(T) unsigned char raw_[N * sizeof(T)];
+    };
+
+    template< class Key, class Value, class Comparator >
+    struct TTTOverflow;
+
     template< class Key, class Value, class Comparator >
     struct TTTNode
     {
       using Node = TTTNode< Key, Value, Comparator >;
+      using OverflowBuffer = TTTOverflow< Key, Value, Comparator >;
+      using T = std::pair< Key, Value >;
 
-      std::pair< Key, Value > data[3];
+      RawValues< T, 2 > data;
       enum NodeType {Empty, Double, Triple, Overflow, Fake} type;
       Node* parent;
       Node* left;
       Node* mid;
       Node* right;
-      Node* overflow;
 
-      void insert(const std::pair< Key, Value >& value);
+      TTTNode(Node* parent = nullptr, Node* left = nullptr, Node* right = nullptr) noexcept;
+      TTTNode(const Node&) = delete;
+      ~TTTNode();
+      Node& operator=(const Node&) = delete;
+
+      template< class... Args >
+      size_t emplace(OverflowBuffer& overflow, Args&&... args);
+      void insert(T&& value);
+      void unsettle(OverflowBuffer& overflow, size_t point) noexcept;
       void remove(NodePoint point) noexcept;
       bool isLeaf() const noexcept;
       void clear()noexcept;
+    private:
+      size_t settle(T& last) noexcept;
     };
 
     template< class Key, class Value, class Comparator >
-    void TTTNode< Key, Value, Comparator >::insert(const std::pair< Key, Value >& value)
+    struct TTTOverflow
+    {
+      RawValues< std::pair< Key, Value >, 1 > data;
+      TTTNode< Key, Value, Comparator >* child;
+    };
+
+    template< class T, size_t N >
+    T& RawValues< T, N >::operator[](size_t i) noexcept
+    {
+      return const_cast< T& >(static_cast< const RawValues& >(*this)[i]);
+    }
+
+    template< class T, size_t N >
+    const T& RawValues< T, N >::operator[](size_t i) const noexcept
+    {
+      assert(i < N && "Index out of node storage");
+      return *reinterpret_cast< const T* >(raw_ + i * sizeof(T));
+    }
+
+    template< class Key, class Value, class Comparator >
+    TTTNode< Key, Value, Comparator >::TTTNode(Node* parent, Node* left, Node* right) noexcept:
+      type(NodeType::Empty),
+      parent(parent),
+      left(left),
+      mid(nullptr),
+      right(right)
+    {}
+
+    template< class Key, class Value, class Comparator >
+    TTTNode< Key, Value, Comparator >::~TTTNode()
+    {
+      assert(type != NodeType::Fake && "Fake nodes are not constructed");
+      size_t live = type;
+      if (type == NodeType::Overflow)
+      {
+        live = 2;
+      }
+      for (size_t i = 0; i < live; i++)
+      {
+        data[i].~T();
+      }
+    }
+
+    template< class Key, class Value, class Comparator >
+    template< class... Args >
+    size_t TTTNode< Key, Value, Comparator >::emplace(OverflowBuffer& overflow, Args&&... args)
+    {
+      assert(type != NodeType::Overflow && type != NodeType::Fake && "Inserting into full node");
+      T* slot = (type == NodeType::Triple) ? std::addressof(overflow.data[0]) : std::addressof(data[type]);
+      new (slot) T(std::forward< Args >(args)...);
+      return settle(*slot);
+    }
+
+    template< class Key, class Value, class Comparator >
+    void TTTNode< Key, Value, Comparator >::insert(T&& value)
+    {
+      assert((type == NodeType::Empty || type == NodeType::Double) && "Inserting into full node");
+      new (std::addressof(data[type])) T(std::move(value));
+      settle(data[type]);
+    }
+
+    template< class Key, class Value, class Comparator >
+    size_t TTTNode< Key, Value, Comparator >::settle(T& last) noexcept
     {
       Comparator cmp;
-      data[type] = value;
       if (type == NodeType::Empty)
       {
         type = NodeType::Double;
-        return;
+        return 0;
       }
       if (type == NodeType::Double)
       {
+        type = NodeType::Triple;
         if (cmp(data[1].first, data[0].first))
         {
           std::swap(data[0], data[1]);
+          return 0;
         }
-        type = NodeType::Triple;
-        return;
+        return 1;
       }
-      if (cmp(data[2].first, data[1].first))
+      type = NodeType::Overflow;
+      if (!cmp(last.first, data[1].first))
       {
-        std::swap(data[2], data[1]);
+        return 2;
       }
+      std::swap(data[1], last);
       if (cmp(data[1].first, data[0].first))
+      {
+        std::swap(data[0], data[1]);
+        return 0;
+      }
+      return 1;
+    }
+
+    template< class Key, class Value, class Comparator >
+    void TTTNode< Key, Value, Comparator >::unsettle(OverflowBuffer& overflow, size_t point) noexcept
+    {
+      assert(type == NodeType::Overflow && "Only overflowing node can be unsettled");
+      if (point == 0)
       {
         std::swap(data[1], data[0]);
       }
-      type = NodeType::Overflow;
+      if (point != 2)
+      {
+        std::swap(overflow.data[0], data[1]);
+      }
+      type = NodeType::Triple;
     }
 
     template< class Key, class Value, class Comparator >
@@ -64,13 +172,15 @@ namespace alymova
       assert(type != NodeType::Empty && "Removing from empty node");
       if (type == NodeType::Double)
       {
+        data[0].~T();
         type = NodeType::Empty;
         return;
       }
       if (point == NodePoint::First)
       {
-        std::swap(data[0], data[1]);
+        data[0] = std::move(data[1]);
       }
+      data[1].~T();
       type = NodeType::Double;
       return;
     }
@@ -92,7 +202,7 @@ namespace alymova
           return false;
         }
       }
-      return (!mid && !overflow);
+      return !mid;
     }
 
     template< class Key, class Value, class Comparator >
@@ -102,7 +212,6 @@ namespace alymova
       left = nullptr;
       mid = nullptr;
       right = nullptr;
-      overflow = nullptr;
     }
   }
 }
@@ -0,0 +1,56 @@
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <tree/tree.hpp>
+#include <tree/persistent_tree.hpp>
+
+namespace
+{
+  using Clock = std::chrono::steady_clock;
+
+  template< typename Map >
+  double forkDatasets(size_t size, size_t forks)
+  {
+    Map base;
+    for (size_t i = 0; i < size; i++)
+    {
+      base[(i * 2654435761u) % size] = std::to_string(i);
+    }
+
+    Clock::time_point start = Clock::now();
+    std::vector< Map > copies;
+    copies.reserve(forks);
+    for (size_t i = 0; i < forks; i++)
+    {
+      copies.push_back(base);
+      copies.back()[(i * 7919) % size] = "changed";
+    }
+    std::chrono::duration< double, std::micro > time = Clock::now() - start;
+    BOOST_TEST(copies.back().size() == size);
+    BOOST_TEST(base.at(0) == "0");
+    return time.count() / forks;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(S4_dataset_benchmark, *boost::unit_test::disabled())
+
+BOOST_AUTO_TEST_CASE(fork_and_modify)
+{
+  std::cout << "tree\tsize\tforks\tus per fork\n";
+  for (size_t size = 1000; size <= 100000; size *= 10)
+  {
+    size_t forks = 2000000 / size;
+    double time = forkDatasets< demehin::PersistentTree< size_t, std::string > >(size, forks);
+    std::cout << "persistent\t" << size << '\t' << forks << '\t' << time << '\n';
+  }
+  for (size_t size = 1000; size <= 100000; size *= 10)
+  {
+    size_t forks = 2000000 / size;
+    double time = forkDatasets< demehin::Tree< size_t, std::string > >(size, forks);
+    std::cout << "deep copy\t" << size << '\t' << forks << '\t' << time << '\n';
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
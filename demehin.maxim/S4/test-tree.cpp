@@ -1,6 +1,11 @@
 #include <boost/test/unit_test.hpp>
+#include <map>
+#include <random>
 #include <sstream>
+#include <stdexcept>
+#include <vector>
 #include <tree/tree.hpp>
+#include <tree/persistent_tree.hpp>
 
 namespace
 {
@@ -11,6 +16,71 @@ namespace
       out << (*it).second;
     }
   }
+
+  using PersistentMap = demehin::PersistentTree< size_t, std::string >;
+
+  bool sameContents(const PersistentMap& tree, const std::map< size_t, std::string >& expected)
+  {
+    if (tree.size() != expected.size())
+    {
+      return false;
+    }
+    auto it = expected.begin();
+    for (auto&& key: tree)
+    {
+      if (key.first != it->first || key.second != it->second)
+      {
+        return false;
+      }
+      ++it;
+    }
+    return true;
+  }
+
+  struct FragileValue
+  {
+    static bool failCopy;
+    static int copiesLeft;
+    int value;
+
+    FragileValue(int v):
+      value(v)
+    {}
+    FragileValue(const FragileValue& other):
+      value(other.value)
+    {
+      if (failCopy || copiesLeft == 0)
+      {
+        throw std::runtime_error("copy failed");
+      }
+      if (copiesLeft > 0)
+      {
+        copiesLeft--;
+      }
+    }
+    FragileValue(FragileValue&& other) noexcept:
+      value(other.value)
+    {}
+  };
+  bool FragileValue::failCopy = false;
+  int FragileValue::copiesLeft = -1;
+
+  bool isSequence(const demehin::PersistentTree< size_t, FragileValue >& tree, size_t count, size_t skipped)
+  {
+    size_t expected = 0;
+    size_t visited = 0;
+    for (auto&& value: tree)
+    {
+      expected += (expected == skipped);
+      if (value.first != expected || value.second.value != static_cast< int >(expected))
+      {
+        return false;
+      }
+      expected++;
+      visited++;
+    }
+    return visited == tree.size() && visited == count;
+  }
 }
 
 BOOST_AUTO_TEST_CASE(extra_test)
@@ -236,3 +306,139 @@ BOOST_AUTO_TEST_CASE(operators_test)
   BOOST_TEST(mv_tree.size() == 2);
   BOOST_TEST(out2.str() == "13");
 }
+
+BOOST_AUTO_TEST_CASE(persistent_copy_test)
+{
+  PersistentMap tree;
+  for (size_t i = 0; i < 10; i++)
+  {
+    tree.insert(std::make_pair(i, std::to_string(i)));
+  }
+
+  PersistentMap cpy_tree = tree;
+  cpy_tree.erase(3);
+  cpy_tree[4] = "four";
+  cpy_tree.at(5) = "five";
+  cpy_tree.insert(std::make_pair(20, "20"));
+
+  BOOST_TEST(tree.size() == 10);
+  BOOST_TEST(tree.count(3) == 1);
+  BOOST_TEST(tree.at(4) == "4");
+  BOOST_TEST(tree.at(5) == "5");
+  BOOST_TEST(tree.count(20) == 0);
+
+  BOOST_TEST(cpy_tree.size() == 10);
+  BOOST_TEST(cpy_tree.count(3) == 0);
+  BOOST_TEST(cpy_tree.at(4) == "four");
+  BOOST_TEST(cpy_tree.at(5) == "five");
+  BOOST_TEST((*cpy_tree.find(20)).second == "20");
+  BOOST_CHECK_THROW(cpy_tree.at(3), std::out_of_range);
+
+  tree.clear();
+  BOOST_TEST(tree.empty());
+  BOOST_TEST(cpy_tree.size() == 10);
+  BOOST_TEST(cpy_tree.begin()->first == 0);
+}
+
+BOOST_AUTO_TEST_CASE(persistent_emplace_test)
+{
+  demehin::PersistentTree< size_t, FragileValue > tree;
+  for (size_t i = 0; i < 10; i++)
+  {
+    BOOST_TEST(tree.emplace(i, FragileValue(i)).second);
+  }
+  auto existing = tree.emplace(4, FragileValue(40));
+  BOOST_TEST(!existing.second);
+  BOOST_TEST(existing.first->second.value == 4);
+
+  demehin::PersistentTree< size_t, FragileValue > snapshot = tree;
+  FragileValue::failCopy = true;
+  BOOST_CHECK_THROW(tree.emplace(20, FragileValue(20)), std::runtime_error);
+  FragileValue::failCopy = false;
+  BOOST_TEST(tree.size() == 10);
+  BOOST_TEST(tree.count(20) == 0);
+  size_t visited = 0;
+  for (auto it = tree.begin(); it != tree.end(); ++it)
+  {
+    visited++;
+  }
+  BOOST_TEST(visited == 10);
+
+  auto inserted = tree.emplace(20, FragileValue(20));
+  BOOST_TEST(inserted.second);
+  BOOST_TEST(inserted.first->second.value == 20);
+  BOOST_TEST(tree.size() == 11);
+  BOOST_TEST(snapshot.size() == 10);
+  BOOST_TEST(snapshot.count(20) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(persistent_erase_exception_test)
+{
+  constexpr size_t size = 31;
+  for (size_t key = 0; key < size; key++)
+  {
+    for (int copies = 0; copies < 8; copies++)
+    {
+      demehin::PersistentTree< size_t, FragileValue > tree;
+      for (size_t i = 0; i < size; i++)
+      {
+        tree.emplace(i, FragileValue(i));
+      }
+      demehin::PersistentTree< size_t, FragileValue > snapshot = tree;
+      FragileValue::copiesLeft = copies;
+      bool erased = true;
+      try
+      {
+        tree.erase(key);
+      }
+      catch (const std::runtime_error&)
+      {
+        erased = tree.count(key) == 0;
+      }
+      FragileValue::copiesLeft = -1;
+      BOOST_TEST(isSequence(snapshot, size, size));
+      BOOST_TEST(isSequence(tree, erased ? size - 1 : size, erased ? key : size));
+      for (size_t i = 0; i < size; i++)
+      {
+        tree.erase(i);
+      }
+      BOOST_TEST(tree.empty());
+      BOOST_TEST(isSequence(snapshot, size, size));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(persistent_snapshots_test)
+{
+  std::mt19937 gen(42);
+  std::uniform_int_distribution< size_t > keys(0, 200);
+  PersistentMap tree;
+  std::map< size_t, std::string > expected;
+  std::vector< PersistentMap > snapshots;
+  std::vector< std::map< size_t, std::string > > expectedSnapshots;
+
+  for (size_t i = 0; i < 3000; i++)
+  {
+    size_t key = keys(gen);
+    if (gen() % 3 == 0)
+    {
+      BOOST_TEST(tree.erase(key) == expected.erase(key));
+    }
+    else
+    {
+      tree[key] = std::to_string(i);
+      expected[key] = std::to_string(i);
+    }
+    if (i % 100 == 0)
+    {
+      snapshots.push_back(tree);
+      expectedSnapshots.push_back(expected);
+    }
+  }
+
+  BOOST_TEST(sameContents(tree, expected));
+  for (size_t i = 0; i < snapshots.size(); i++)
+  {
+    BOOST_TEST(sameContents(snapshots[i], expectedSnapshots[i]));
+  }
+}
@@ -4,7 +4,7 @@ void demehin::print(std::ostream& out, std::istream& in, const MapOfTrees& mapOf
 {
   std::string datasetName;
   in >> datasetName;
-  TreeMap map = mapOfTrees.at(datasetName);
+  const TreeMap& map = mapOfTrees.at(datasetName);
   if (map.empty())
   {
     out << "<EMPTY>\n";
@@ -23,21 +23,16 @@ void demehin::makeComplement(std::istream& in, MapOfTrees& mapOfTrees)
 {
   std::string newName, name1, name2;
   in >> newName >> name1 >> name2;
-  TreeMap newMap, map1, map2;
-  if (mapOfTrees.at(name1).size() > mapOfTrees.at(name2).size())
-  {
-    map1 = mapOfTrees.at(name1);
-    map2 = mapOfTrees.at(name2);
-  }
-  else
-  {
-    map1 = mapOfTrees.at(name2);
-    map2 = mapOfTrees.at(name1);
-  }
+  const TreeMap& lhs = mapOfTrees.at(name1);
+  const TreeMap& rhs = mapOfTrees.at(name2);
+  const bool lhsLarger = lhs.size() > rhs.size();
+  const TreeMap& map1 = lhsLarger ? lhs : rhs;
+  const TreeMap& map2 = lhsLarger ? rhs : lhs;
+  TreeMap newMap;
 
   for (auto&& key: map1)
   {
-    if (map2.find(key.first) == map2.end())
+    if (map2.count(key.first) == 0)
     {
       newMap.insert(key);
     }
@@ -61,12 +56,12 @@ void demehin::makeIntersect(std::istream& in, MapOfTrees& mapOfTrees)
 {
   std::string newName, lhsName, rhsName;
   in >> newName >> lhsName >> rhsName;
-  TreeMap newMap, lhsMap, rhsMap;
-  lhsMap = mapOfTrees.at(lhsName);
-  rhsMap = mapOfTrees.at(rhsName);
+  const TreeMap& lhsMap = mapOfTrees.at(lhsName);
+  const TreeMap& rhsMap = mapOfTrees.at(rhsName);
+  TreeMap newMap;
   for (auto&& key: lhsMap)
   {
-    if (rhsMap.find(key.first) != rhsMap.end())
+    if (rhsMap.count(key.first) != 0)
     {
       newMap.insert(key);
     }
@@ -89,19 +84,11 @@ void demehin::makeUnion(std::istream& in, MapOfTrees& mapOfTrees)
 {
   std::string newName, lhsName, rhsName;
   in >> newName >> lhsName >> rhsName;
-  TreeMap newMap, lhsMap, rhsMap;
-  lhsMap = mapOfTrees.at(lhsName);
-  rhsMap = mapOfTrees.at(rhsName);
-  for (auto&& key: lhsMap)
-  {
-    newMap.insert(key);
-  }
+  const TreeMap& rhsMap = mapOfTrees.at(rhsName);
+  TreeMap newMap = mapOfTrees.at(lhsName);
   for (auto&& key: rhsMap)
   {
-    if (newMap.find(key.first) == newMap.end())
-    {
-      newMap.insert(key);
-    }
+    newMap.insert(key);
   }
 
   if (newName == lhsName)
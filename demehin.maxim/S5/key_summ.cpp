@@ -13,7 +13,7 @@ namespace
       return a > max - b;
     }
 
-    return (a < 0 && b < 0) && (a < min + b);
+    return (a < 0 && b < 0) && (a < min - b);
   }
 }
 
@@ -22,7 +22,7 @@ demehin::KeySumm::KeySumm() noexcept:
   str_res("")
 {}
 
-void demehin::KeySumm::operator()(const std::pair< const int, std::string >& data)
+void demehin::KeySumm::operator()(const std::pair< int, std::string >& data)
 {
   if (isOverflow(val_res, data.first))
   {
@@ -30,12 +30,9 @@ void demehin::KeySumm::operator()(const std::pair< const int, std::string >& dat
   }
 
   val_res += data.first;
-  if (str_res.size() == 0)
+  if (!str_res.empty())
   {
-    str_res = data.second;
-  }
-  else
-  {
-    str_res = str_res + " " + data.second;
+    str_res += ' ';
   }
+  str_res += data.second;
 }
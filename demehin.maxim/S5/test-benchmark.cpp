@@ -0,0 +1,62 @@
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <iostream>
+#include <tree/tree.hpp>
+
+namespace
+{
+  using Clock = std::chrono::steady_clock;
+  using Map = demehin::Tree< int, int >;
+
+  struct KeyCount
+  {
+    long long sum = 0;
+    size_t count = 0;
+
+    void operator()(const std::pair< int, int >& data)
+    {
+      sum += data.first;
+      count++;
+    }
+  };
+
+  template< typename Traverse >
+  void measure(const char* name, const Map& tree, Traverse traverse)
+  {
+    Clock::time_point start = Clock::now();
+    KeyCount res = traverse(tree, KeyCount());
+    std::chrono::duration< double, std::nano > time = Clock::now() - start;
+    std::cout << name << '\t' << tree.size() << '\t' << time.count() / tree.size() << '\n';
+    BOOST_TEST(res.count == tree.size());
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(S5_traversal_benchmark, *boost::unit_test::disabled())
+
+BOOST_AUTO_TEST_CASE(traverse_orders)
+{
+  std::cout << "order\tsize\tns per node\n";
+  for (size_t size = 100000; size <= 10000000; size *= 10)
+  {
+    Map tree;
+    for (size_t i = 0; i < size; i++)
+    {
+      int key = static_cast< int >((i * 2654435761u) % size);
+      tree.insert(std::make_pair(key, key));
+    }
+    measure("ascending", tree, [](const Map& map, KeyCount res)
+    {
+      return map.traverse_lnr(res);
+    });
+    measure("descending", tree, [](const Map& map, KeyCount res)
+    {
+      return map.traverse_rnl(res);
+    });
+    measure("breadth", tree, [](const Map& map, KeyCount res)
+    {
+      return map.traverse_breadth(res);
+    });
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
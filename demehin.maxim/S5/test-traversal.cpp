@@ -2,6 +2,9 @@
 #include <sstream>
 #include <string>
 #include <limits>
+#include <random>
+#include <set>
+#include <vector>
 #include <tree/tree.hpp>
 #include "key_summ.hpp"
 
@@ -78,3 +81,70 @@ BOOST_AUTO_TEST_CASE(traversal_big_tree_test)
   BOOST_TEST(rnl_res.str_res == "rightright right rightleft root leftright left leftleft");
   BOOST_TEST(br_res.str_res == "root left right leftleft leftright rightleft rightright");
 }
+
+BOOST_AUTO_TEST_CASE(traversal_empty_iterators_test)
+{
+  demehin::Tree< int, std::string > tree;
+
+  BOOST_TEST((tree.lnrBegin() == tree.lnrEnd()));
+  BOOST_TEST((tree.clnrBegin() == tree.clnrEnd()));
+  BOOST_TEST((tree.rnlBegin() == tree.rnlEnd()));
+  BOOST_TEST((tree.crnlBegin() == tree.crnlEnd()));
+
+  tree[1] = "one";
+  tree.erase(1);
+  BOOST_TEST((tree.lnrBegin() == tree.lnrEnd()));
+  BOOST_TEST((tree.rnlBegin() == tree.rnlEnd()));
+
+  auto it = tree.lnrEnd();
+  BOOST_TEST((++it == tree.lnrEnd()));
+}
+
+BOOST_AUTO_TEST_CASE(traversal_iterators_order_test)
+{
+  std::mt19937 gen(7);
+  std::uniform_int_distribution< int > keys(-1000, 1000);
+  demehin::Tree< int, std::string > tree;
+  std::set< int > expected;
+
+  for (size_t i = 0; i < 500; i++)
+  {
+    int key = keys(gen);
+    tree[key] = std::to_string(key);
+    expected.insert(key);
+    if (i % 4 == 0)
+    {
+      int erased = keys(gen);
+      tree.erase(erased);
+      expected.erase(erased);
+    }
+  }
+
+  std::vector< int > lnr;
+  for (auto it = tree.lnrBegin(); it != tree.lnrEnd(); it++)
+  {
+    lnr.push_back(it->first);
+  }
+  std::vector< int > clnr;
+  for (auto it = tree.clnrBegin(); it != tree.clnrEnd(); ++it)
+  {
+    clnr.push_back((*it).first);
+  }
+  std::vector< int > rnl;
+  for (auto it = tree.rnlBegin(); it != tree.rnlEnd(); it++)
+  {
+    rnl.push_back(it->first);
+  }
+  std::vector< int > crnl;
+  for (auto it = tree.crnlBegin(); it != tree.crnlEnd(); ++it)
+  {
+    crnl.push_back((*it).first);
+  }
+
+  std::vector< int > sorted(expected.begin(), expected.end());
+  std::vector< int > reversed(expected.rbegin(), expected.rend());
+  BOOST_TEST(lnr == sorted);
+  BOOST_TEST(clnr == sorted);
+  BOOST_TEST(rnl == reversed);
+  BOOST_TEST(crnl == reversed);
+}
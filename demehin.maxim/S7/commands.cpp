@@ -26,17 +26,6 @@ namespace
       out << "\n";
     }
   }
-
-  void addEdges(demehin::Graph& gr, const demehin::Graph::Edges& edges)
-  {
-    for (auto it = edges.cbegin(); it != edges.cend(); it++)
-    {
-      for (auto&& weight: it->second)
-      {
-        gr.addEdge(it->first.first, it->first.second, weight);
-      }
-    }
-  }
 }
 
 void demehin::printGraphsNames(std::ostream& out, const MapOfGraphs& graphs)
@@ -57,7 +46,7 @@ void demehin::printVertexesNames(std::ostream& out, std::istream& in, const MapO
 {
   std::string gr_name;
   in >> gr_name;
-  Graph gr = graphs.at(gr_name);
+  const Graph& gr = graphs.at(gr_name);
 
   if (gr.getVrts().empty())
   {
@@ -77,7 +66,7 @@ void demehin::printOutbounds(std::ostream& out, std::istream& in, const MapOfGra
   std::string gr_name, vrt_name;
   in >> gr_name >> vrt_name;
 
-  Graph gr = graphs.at(gr_name);
+  const Graph& gr = graphs.at(gr_name);
 
   if (!gr.hasVrt(vrt_name))
   {
@@ -93,7 +82,7 @@ void demehin::printInbounds(std::ostream& out, std::istream& in, const MapOfGrap
   std::string gr_name, vrt_name;
   in >> gr_name >> vrt_name;
 
-  Graph gr = graphs.at(gr_name);
+  const Graph& gr = graphs.at(gr_name);
 
   if (!gr.hasVrt(vrt_name))
   {
@@ -175,15 +164,8 @@ void demehin::merge(std::istream& in, MapOfGraphs& graphs)
     throw std::logic_error("incorrect parameters");
   }
 
-  Graph res;
-
-  auto g1 = graphs[gr1_name];
-  auto edges1 = g1.getEdges();
-  addEdges(res, edges1);
-
-  auto g2 = graphs[gr2_name];
-  auto edges2 = g2.getEdges();
-  addEdges(res, edges2);
+  Graph res = graphs[gr1_name];
+  res.addGraph(graphs[gr2_name]);
 
   graphs[new_gr_name] = res;
 }
@@ -199,7 +181,7 @@ void demehin::extract(std::istream& in, MapOfGraphs& graphs)
   }
 
   List< std::string > vrts;
-  auto gr = graphs.at(gr_name);
+  const Graph& gr = graphs.at(gr_name);
   for (size_t i = 0; i < vrt_cnt; i++)
   {
     std::string vrt;
@@ -211,33 +193,6 @@ void demehin::extract(std::istream& in, MapOfGraphs& graphs)
     vrts.push_back(vrt);
   }
 
-  Graph new_gr;
-
-  for (auto it = gr.getEdges().cbegin(); it != gr.getEdges().cend(); it++)
-  {
-    std::string from = it->first.first;
-    std::string to = it->first.second;
-    bool from_found = false;
-    bool to_found = false;
-    for (auto&& v: vrts)
-    {
-      if (v == from)
-      {
-        from_found = true;
-      }
-      if (v == to)
-      {
-        to_found = true;
-      }
-    }
-
-    if (from_found && to_found)
-    {
-      for (auto&& w: it->second)
-      {
-        new_gr.addEdge(from, to, w);
-      }
-    }
-  }
+  Graph new_gr = gr.getSubgraph(vrts);
   graphs[new_gr_name] = new_gr;
 }
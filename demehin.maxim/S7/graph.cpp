@@ -1,107 +1,154 @@
 #include "graph.hpp"
 
-void demehin::Graph::addVertex(const std::string& vrt) noexcept
+size_t demehin::Graph::getId(const std::string& vrt)
 {
-  if (!hasVrt(vrt))
+  auto it = ids.find(vrt);
+  if (it != ids.end())
   {
-    addEdge(vrt, vrt, 0);
+    return it->second;
   }
+
+  Vertex newVrt;
+  newVrt.name = vrt;
+  vrts.push(std::move(newVrt));
+  ids.insert(std::make_pair(vrt, vrts.size() - 1));
+  return vrts.size() - 1;
+}
+
+void demehin::Graph::addVertex(const std::string& vrt)
+{
+  getId(vrt);
 }
 
 void demehin::Graph::addEdge(const std::string& from, const std::string& to, unsigned int weight)
 {
-  auto key = std::make_pair(from, to);
-  edges[key].push_back(weight);
+  size_t fromId = getId(from);
+  size_t toId = getId(to);
+  vrts[fromId].outbounds.push({ static_cast< unsigned int >(toId), weight });
+  vrts[toId].inbounds.push({ static_cast< unsigned int >(fromId), weight });
 }
 
-demehin::Tree< std::string, std::string > demehin::Graph::getVrts() const
+bool demehin::Graph::deleteEdge(const std::string& from, const std::string& to, unsigned int weight)
 {
-  Tree< std::string, std::string > vrts;
-  for (auto it = edges.cbegin(); it != edges.cend(); it++)
+  auto fromIt = ids.find(from);
+  auto toIt = ids.find(to);
+  if (fromIt == ids.end() || toIt == ids.end())
   {
-    vrts[it->first.first];
-    vrts[it->first.second];
+    return false;
   }
-  return vrts;
+
+  size_t fromId = fromIt->second;
+  size_t toId = toIt->second;
+  size_t removed = removeEdges(vrts[fromId].outbounds, toId, weight);
+  removeEdges(vrts[toId].inbounds, fromId, weight);
+  return removed != 0;
 }
 
-bool demehin::Graph::hasVrt(const std::string& vrt) const
+size_t demehin::Graph::removeEdges(DynamicArray< Edge >& edges, size_t vrt, unsigned int weight)
 {
-  for (auto it = edges.cbegin(); it != edges.cend(); it++)
+  size_t removed = 0;
+  size_t i = 0;
+  while (i < edges.size())
   {
-    if (it->first.first == vrt || it->first.second == vrt)
+    if (edges[i].vrt == vrt && edges[i].weight == weight)
+    {
+      edges[i] = edges.back();
+      edges.pop_back();
+      removed++;
+    }
+    else
     {
-      return true;
+      i++;
     }
   }
-  return false;
+  return removed;
 }
 
-demehin::Tree< std::string, demehin::Tree< unsigned int, size_t > > demehin::Graph::getOutbounds(const std::string& vrt) const
+void demehin::Graph::addGraph(const Graph& other)
 {
-  Tree< std::string, Tree< unsigned int, size_t > > res;
-
-  for (auto it = edges.cbegin(); it != edges.cend(); it++)
+  for (size_t i = 0; i < other.vrts.size(); i++)
+  {
+    addVertex(other.vrts[i].name);
+  }
+  for (size_t i = 0; i < other.vrts.size(); i++)
   {
-    if (it->first.first == vrt)
+    const Vertex& from = other.vrts[i];
+    for (auto&& edge: from.outbounds)
     {
-      std::string target = it->first.second;
-      for (auto&& weight: it->second)
-      {
-        res[target][weight]++;
-      }
+      addEdge(from.name, other.vrts[edge.vrt].name, edge.weight);
     }
   }
-  return res;
 }
 
-demehin::Tree< std::string, demehin::Tree< unsigned int, size_t > > demehin::Graph::getInbounds(const std::string& vrt) const
+demehin::Graph demehin::Graph::getSubgraph(const List< std::string >& names) const
 {
-  Tree< std::string, Tree< unsigned int, size_t > > res;
+  Graph res;
+  for (auto&& name: names)
+  {
+    res.addVertex(name);
+  }
 
-  for (auto it = edges.cbegin(); it != edges.cend(); it++)
+  for (size_t i = 0; i < res.vrts.size(); i++)
   {
-    if (it->first.second == vrt)
+    const std::string from = res.vrts[i].name;
+    auto fromIt = ids.find(from);
+    if (fromIt == ids.cend())
     {
-      std::string target = it->first.first;
-      for (auto&& weight: it->second)
+      continue;
+    }
+    for (auto&& edge: vrts[fromIt->second].outbounds)
+    {
+      const std::string& to = vrts[edge.vrt].name;
+      if (res.hasVrt(to))
       {
-        res[target][weight]++;
+        res.addEdge(from, to, edge.weight);
       }
     }
   }
   return res;
 }
 
-bool demehin::Graph::deleteEdge(const std::string& from, const std::string& to, unsigned int weight)
+demehin::Tree< std::string, std::string > demehin::Graph::getVrts() const
 {
-  auto key = std::make_pair(from, to);
-  auto edgeIt = edges.find(key);
-
-  if (edgeIt == edges.end())
+  Tree< std::string, std::string > res;
+  for (size_t i = 0; i < vrts.size(); i++)
   {
-    return false;
+    res[vrts[i].name];
   }
+  return res;
+}
 
-  auto& weights = edgeIt->second;
-  bool isDeleted = false;
-  for (auto it = weights.cbegin(); it != weights.cend();)
+bool demehin::Graph::hasVrt(const std::string& vrt) const
+{
+  return ids.find(vrt) != ids.cend();
+}
+
+demehin::Graph::Bounds demehin::Graph::collectBounds(const DynamicArray< Edge >& edges) const
+{
+  Bounds res;
+  for (auto&& edge: edges)
   {
-    if (*it == weight)
-    {
-      it = weights.erase(it);
-      isDeleted = true;
-    }
-    else
-    {
-      it++;
-    }
+    res[vrts[edge.vrt].name][edge.weight]++;
   }
+  return res;
+}
 
-  return isDeleted;
+demehin::Graph::Bounds demehin::Graph::getOutbounds(const std::string& vrt) const
+{
+  auto it = ids.find(vrt);
+  if (it == ids.cend())
+  {
+    return Bounds();
+  }
+  return collectBounds(vrts[it->second].outbounds);
 }
 
-const demehin::Graph::Edges& demehin::Graph::getEdges() const
+demehin::Graph::Bounds demehin::Graph::getInbounds(const std::string& vrt) const
 {
-  return edges;
+  auto it = ids.find(vrt);
+  if (it == ids.cend())
+  {
+    return Bounds();
+  }
+  return collectBounds(vrts[it->second].inbounds);
 }
@@ -1,37 +1,48 @@
 #ifndef GRAPH_HPP
 #define GRAPH_HPP
 #include <string>
+#include <dynamic_array.hpp>
 #include <list/list.hpp>
 #include <tree/tree.hpp>
 #include "hash_table.hpp"
 
 namespace demehin
 {
-  struct PairHash
-  {
-    size_t operator()(const std::pair< std::string, std::string >& p) const
-    {
-      return std::hash< std::string >()(p.first) ^ std::hash< std::string >()(p.second);
-    }
-  };
-
   class Graph
   {
   public:
-    using PairOfStr = std::pair< std::string, std::string >;
-    using Edges = HashTable< PairOfStr, List< unsigned int >, PairHash >;
+    using Bounds = Tree< std::string, Tree< unsigned int, size_t > >;
 
-    void addVertex(const std::string&) noexcept;
+    void addVertex(const std::string&);
     void addEdge(const std::string&, const std::string&, unsigned int);
     bool deleteEdge(const std::string&, const std::string&, unsigned int);
-    const Edges& getEdges() const;
+    void addGraph(const Graph&);
+    Graph getSubgraph(const List< std::string >&) const;
     Tree< std::string, std::string > getVrts() const;
-    Tree< std::string, Tree< unsigned int, size_t > > getOutbounds(const std::string&) const;
-    Tree< std::string, Tree< unsigned int, size_t > > getInbounds(const std::string&) const;
+    Bounds getOutbounds(const std::string&) const;
+    Bounds getInbounds(const std::string&) const;
     bool hasVrt(const std::string&) const;
 
   private:
-    Edges edges;
+    struct Edge
+    {
+      unsigned int vrt;
+      unsigned int weight;
+    };
+
+    struct Vertex
+    {
+      std::string name;
+      DynamicArray< Edge > outbounds{ 0 };
+      DynamicArray< Edge > inbounds{ 0 };
+    };
+
+    HashTable< std::string, size_t > ids;
+    DynamicArray< Vertex > vrts;
+
+    size_t getId(const std::string&);
+    Bounds collectBounds(const DynamicArray< Edge >&) const;
+    static size_t removeEdges(DynamicArray< Edge >&, size_t, unsigned int);
   };
 }
 
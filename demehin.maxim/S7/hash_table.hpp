@@ -1,6 +1,7 @@
 #ifndef HASH_TABLE_HPP
 #define HASH_TABLE_HPP
 #include <functional>
+#include <limits>
 #include <dynamic_array.hpp>
 #include "hash_table_iterator.hpp"
 
@@ -55,6 +56,8 @@ namespace demehin
     float load_factor() const noexcept;
     float max_load_factor() const noexcept;
     void max_load_factor(float);
+    bool power_of_two() const noexcept;
+    void power_of_two(bool);
 
     Iter begin() noexcept;
     Iter end() noexcept;
@@ -83,17 +86,23 @@ namespace demehin
     Hash hasher_;
     Equal equal_;
     float max_load_factor_ = 0.7;
+    bool power_of_two_ = true;
+    size_t shift_;
 
+    size_t homeIndex(const Key&, size_t, size_t) const noexcept;
+    size_t probeIndex(size_t, size_t, size_t) const noexcept;
     size_t findKey(const Key&) const;
     size_t findSlot(const Key&) const;
-    size_t findSlotIn(const Key&, const DynamicArray< Slot >&) const noexcept;
+    size_t findSlotIn(const Key&, const DynamicArray< Slot >&, size_t) const noexcept;
+    void rebuild(size_t);
 
   };
 
   template< typename Key, typename T, typename Hash, typename Equal >
   HashTable< Key, T, Hash, Equal >::HashTable():
     slots_(16),
-    item_cnt_(0)
+    item_cnt_(0),
+    shift_(std::numeric_limits< size_t >::digits - 4)
   {}
 
   template< typename Key, typename T, typename Hash, typename Equal >
@@ -117,86 +126,107 @@ namespace demehin
     }
   }
 
+  template< typename Key, typename T, typename Hash, typename Equal >
+  size_t HashTable< Key, T, Hash, Equal >::homeIndex(const Key& key, size_t cap, size_t shift) const noexcept
+  {
+    size_t hash_val = hasher_(key);
+    if (power_of_two_)
+    {
+      return (hash_val * static_cast< size_t >(0x9E3779B97F4A7C15ull)) >> shift;
+    }
+    return hash_val % cap;
+  }
+
+  template< typename Key, typename T, typename Hash, typename Equal >
+  size_t HashTable< Key, T, Hash, Equal >::probeIndex(size_t home, size_t i, size_t cap) const noexcept
+  {
+    if (power_of_two_)
+    {
+      return (home + i * (i + 1) / 2) & (cap - 1);
+    }
+    if (i < cap)
+    {
+      return (home + i * i) % cap;
+    }
+    return (home + i) % cap;
+  }
+
   template< typename Key, typename T, typename Hash, typename Equal >
   size_t HashTable< Key, T, Hash, Equal >::findKey(const Key& key) const
   {
-    size_t hash_val = hasher_(key) % slots_.size();
+    size_t cap = slots_.size();
+    size_t hash_val = homeIndex(key, cap, shift_);
     size_t ind = hash_val;
-    size_t i = 1;
 
-    while (slots_[ind].state != SlotState::EMPTY)
+    for (size_t i = 1; slots_[ind].state != SlotState::EMPTY && i <= 2 * cap; i++)
     {
       if (slots_[ind].state == SlotState::OCCUPIED && equal_(slots_[ind].pair.first, key))
       {
         return ind;
       }
-      ind = (hash_val + i * i) % slots_.size();
-      i++;
-
-      if (i > slots_.size())
-      {
-        break;
-      }
+      ind = probeIndex(hash_val, i, cap);
     }
-    return slots_.size();
+    return cap;
   }
 
   template< typename Key, typename T, typename Hash, typename Equal >
   size_t HashTable< Key, T, Hash, Equal >::findSlot(const Key& key) const
   {
-    size_t hash_val = hasher_(key) % slots_.size();
-    size_t first_deleted = slots_.size();
+    size_t cap = slots_.size();
+    size_t hash_val = homeIndex(key, cap, shift_);
+    size_t first_deleted = cap;
     size_t ind = hash_val;
-    size_t i = 1;
 
-    while (slots_[ind].state != SlotState::EMPTY)
+    for (size_t i = 1; slots_[ind].state != SlotState::EMPTY; i++)
     {
       if (slots_[ind].state == SlotState::OCCUPIED && equal_(slots_[ind].pair.first, key))
       {
         return ind;
       }
 
-      if (slots_[ind].state == SlotState::DELETED && first_deleted == slots_.size())
+      if (slots_[ind].state == SlotState::DELETED && first_deleted == cap)
       {
         first_deleted = ind;
       }
 
-      ind = (hash_val + i * i) % slots_.size();
-      i++;
-
-      if (i > slots_.size())
+      if (i == 2 * cap)
       {
-        break;
+        return first_deleted;
       }
+      ind = probeIndex(hash_val, i, cap);
     }
-    return (first_deleted != slots_.size()) ? first_deleted : ind;
+    return (first_deleted != cap) ? first_deleted : ind;
   }
 
   template< typename Key, typename T, typename Hash, typename Equal >
-  size_t HashTable< Key, T, Hash, Equal >::findSlotIn(const Key& key, const DynamicArray< Slot >& target) const noexcept
+  size_t HashTable< Key, T, Hash, Equal >::findSlotIn(const Key& key, const DynamicArray< Slot >& target, size_t shift) const noexcept
   {
-    size_t hash_val = hasher_(key) % target.size();
+    size_t hash_val = homeIndex(key, target.size(), shift);
     size_t ind = hash_val;
     size_t i = 1;
 
     while (target[ind].state == SlotState::OCCUPIED)
     {
-      ind = (hash_val + i * i) % target.size();
+      ind = probeIndex(hash_val, i, target.size());
       i++;
     }
     return ind;
   }
 
   template< typename Key, typename T, typename Hash, typename Equal >
-  void HashTable< Key, T, Hash, Equal >::rehash(size_t new_size)
+  void HashTable< Key, T, Hash, Equal >::rebuild(size_t new_size)
   {
-    if (new_size < item_cnt_ / max_load_factor_)
+    size_t new_shift = shift_;
+    if (power_of_two_)
     {
-      new_size = static_cast< size_t >(item_cnt_ / max_load_factor_) + 1;
-    }
-    if (new_size <= slots_.size())
-    {
-      return;
+      size_t cap = 2;
+      new_shift = std::numeric_limits< size_t >::digits - 1;
+      while (cap < new_size)
+      {
+        cap <<= 1;
+        new_shift--;
+      }
+      new_size = cap;
     }
 
     DynamicArray< Slot > new_slots(new_size);
@@ -204,12 +234,27 @@ namespace demehin
     {
       if (slot.state == SlotState::OCCUPIED)
       {
-        size_t ind = findSlotIn(slot.pair.first, new_slots);
+        size_t ind = findSlotIn(slot.pair.first, new_slots, new_shift);
         new_slots[ind] = slot;
         new_slots[ind].state = SlotState::OCCUPIED;
       }
     }
     slots_ = std::move(new_slots);
+    shift_ = new_shift;
+  }
+
+  template< typename Key, typename T, typename Hash, typename Equal >
+  void HashTable< Key, T, Hash, Equal >::rehash(size_t new_size)
+  {
+    if (new_size < item_cnt_ / max_load_factor_)
+    {
+      new_size = static_cast< size_t >(item_cnt_ / max_load_factor_) + 1;
+    }
+    if (new_size <= slots_.size())
+    {
+      return;
+    }
+    rebuild(new_size);
   }
 
   template< typename Key, typename T, typename Hash, typename Equal >
@@ -234,6 +279,31 @@ namespace demehin
     }
   }
 
+  template< typename Key, typename T, typename Hash, typename Equal >
+  bool HashTable< Key, T, Hash, Equal >::power_of_two() const noexcept
+  {
+    return power_of_two_;
+  }
+
+  template< typename Key, typename T, typename Hash, typename Equal >
+  void HashTable< Key, T, Hash, Equal >::power_of_two(bool mode)
+  {
+    if (mode == power_of_two_)
+    {
+      return;
+    }
+    power_of_two_ = mode;
+    try
+    {
+      rebuild(slots_.size());
+    }
+    catch (...)
+    {
+      power_of_two_ = !mode;
+      throw;
+    }
+  }
+
   template< typename Key, typename T, typename Hash, typename Equal >
   size_t HashTable< Key, T, Hash, Equal >::size() const noexcept
   {
@@ -365,7 +435,7 @@ namespace demehin
   template< typename Key, typename T, typename Hash, typename Equal >
   const T& HashTable< Key, T, Hash, Equal >::at(const Key& key) const
   {
-    size_t ind = find_key(key);
+    size_t ind = findKey(key);
     if (ind == slots_.size())
     {
       throw std::logic_error("key not found");
@@ -463,6 +533,9 @@ namespace demehin
     std::swap(item_cnt_, other.item_cnt_);
     std::swap(hasher_, other.hasher_);
     std::swap(equal_, other.equal_);
+    std::swap(max_load_factor_, other.max_load_factor_);
+    std::swap(power_of_two_, other.power_of_two_);
+    std::swap(shift_, other.shift_);
   }
 }
 
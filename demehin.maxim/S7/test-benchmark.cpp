@@ -0,0 +1,75 @@
+#include <chrono>
+#include <string>
+#include <vector>
+#include <iostream>
+#include <boost/test/unit_test.hpp>
+#include "hash_table.hpp"
+
+namespace
+{
+  using Clock = std::chrono::steady_clock;
+
+  template< typename Key >
+  void runTable(const std::vector< Key >& keys, bool powerOfTwo, const char* name)
+  {
+    demehin::HashTable< Key, size_t > table;
+    table.power_of_two(powerOfTwo);
+
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < keys.size(); i++)
+    {
+      table.insert(std::make_pair(keys[i], i));
+    }
+    std::chrono::duration< double, std::nano > insertTime = Clock::now() - start;
+
+    size_t found = 0;
+    start = Clock::now();
+    for (size_t round = 0; round < 4; round++)
+    {
+      for (size_t i = 0; i < keys.size(); i++)
+      {
+        found += table.find(keys[i]) != table.end();
+      }
+    }
+    std::chrono::duration< double, std::nano > lookupTime = Clock::now() - start;
+
+    std::cout << name << '\t' << (powerOfTwo ? "pow2" : "modulo") << '\t' << keys.size();
+    std::cout << '\t' << insertTime.count() / keys.size() << '\t' << lookupTime.count() / (4 * keys.size()) << '\n';
+    BOOST_TEST(table.size() == keys.size());
+    BOOST_TEST(found == 4 * keys.size());
+  }
+
+  template< typename Key >
+  void compareModes(const std::vector< Key >& keys, const char* name)
+  {
+    runTable(keys, false, name);
+    runTable(keys, true, name);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(S7_hash_table_benchmark, *boost::unit_test::disabled())
+
+BOOST_AUTO_TEST_CASE(probing_modes)
+{
+  std::cout << "keys\tmode\tsize\tinsert ns\tlookup ns\n";
+  for (size_t size = 1000; size <= 1000000; size *= 10)
+  {
+    std::vector< size_t > sequential;
+    std::vector< size_t > strided;
+    std::vector< std::string > names;
+    for (size_t i = 0; i < size; i++)
+    {
+      sequential.push_back(i);
+      strided.push_back(i * 64);
+      names.push_back("v" + std::to_string(i));
+    }
+    compareModes(sequential, "sequential");
+    if (size <= 10000)
+    {
+      compareModes(strided, "stride64");
+    }
+    compareModes(names, "string");
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
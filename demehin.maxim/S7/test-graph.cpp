@@ -0,0 +1,89 @@
+#include <boost/test/unit_test.hpp>
+#include "graph.hpp"
+
+BOOST_AUTO_TEST_CASE(vertex_without_edges_test)
+{
+  demehin::Graph gr;
+  gr.addVertex("a");
+  gr.addVertex("b");
+  gr.addVertex("a");
+
+  BOOST_TEST(gr.hasVrt("a"));
+  BOOST_TEST(gr.hasVrt("b"));
+  BOOST_TEST(!gr.hasVrt("c"));
+  BOOST_TEST(gr.getVrts().size() == 2);
+  BOOST_TEST(gr.getOutbounds("a").empty());
+  BOOST_TEST(gr.getInbounds("a").empty());
+}
+
+BOOST_AUTO_TEST_CASE(edges_test)
+{
+  demehin::Graph gr;
+  gr.addEdge("a", "b", 3);
+  gr.addEdge("a", "b", 1);
+  gr.addEdge("a", "b", 3);
+  gr.addEdge("c", "a", 2);
+
+  auto outbounds = gr.getOutbounds("a");
+  BOOST_TEST(outbounds.size() == 1);
+  BOOST_TEST(outbounds.at("b").at(3) == 2);
+  BOOST_TEST(outbounds.at("b").at(1) == 1);
+  BOOST_TEST(gr.getInbounds("a").at("c").at(2) == 1);
+  BOOST_TEST(gr.getInbounds("b").at("a").size() == 2);
+
+  BOOST_TEST(gr.deleteEdge("a", "b", 3));
+  BOOST_TEST(!gr.deleteEdge("a", "b", 3));
+  BOOST_TEST(!gr.deleteEdge("b", "a", 1));
+  BOOST_TEST(gr.getOutbounds("a").at("b").size() == 1);
+  BOOST_TEST(gr.getInbounds("b").at("a").size() == 1);
+  BOOST_TEST(gr.hasVrt("b"));
+}
+
+BOOST_AUTO_TEST_CASE(merge_and_subgraph_test)
+{
+  demehin::Graph gr1;
+  gr1.addEdge("a", "b", 1);
+  gr1.addVertex("d");
+  demehin::Graph gr2;
+  gr2.addEdge("b", "c", 2);
+  gr2.addEdge("a", "b", 1);
+
+  demehin::Graph merged = gr1;
+  merged.addGraph(gr2);
+  BOOST_TEST(merged.getVrts().size() == 4);
+  BOOST_TEST(merged.getOutbounds("a").at("b").at(1) == 2);
+  BOOST_TEST(merged.getInbounds("c").at("b").at(2) == 1);
+  BOOST_TEST(gr1.getVrts().size() == 3);
+
+  demehin::List< std::string > names;
+  names.push_back("b");
+  names.push_back("c");
+  names.push_back("d");
+  demehin::Graph sub = merged.getSubgraph(names);
+  BOOST_TEST(sub.getVrts().size() == 3);
+  BOOST_TEST(!sub.hasVrt("a"));
+  BOOST_TEST(sub.getOutbounds("b").at("c").at(2) == 1);
+  BOOST_TEST(sub.getInbounds("b").empty());
+}
+
+BOOST_AUTO_TEST_CASE(many_vertices_test)
+{
+  demehin::Graph gr;
+  const unsigned int count = 3000;
+  for (unsigned int i = 0; i < count; i++)
+  {
+    gr.addEdge("v" + std::to_string(i), "v" + std::to_string((i + 1) % count), i);
+  }
+
+  BOOST_TEST(gr.getVrts().size() == count);
+  bool linked = true;
+  for (unsigned int i = 0; i < count; i++)
+  {
+    std::string name = "v" + std::to_string(i);
+    auto outbounds = gr.getOutbounds(name);
+    auto inbounds = gr.getInbounds(name);
+    linked = linked && outbounds.size() == 1 && outbounds.at("v" + std::to_string((i + 1) % count)).at(i) == 1;
+    linked = linked && inbounds.size() == 1 && inbounds.at("v" + std::to_string((i + count - 1) % count)).count((i + count - 1) % count) == 1;
+  }
+  BOOST_TEST(linked);
+}
@@ -114,3 +114,39 @@ BOOST_AUTO_TEST_CASE(load_factor_test)
   table.max_load_factor(0.5);
   BOOST_TEST(table.max_load_factor() == 0.5);
 }
+
+BOOST_AUTO_TEST_CASE(probing_modes_test)
+{
+  demehin::HashTable< int, int > pow2;
+  demehin::HashTable< int, int > legacy;
+  legacy.power_of_two(false);
+  BOOST_TEST(pow2.power_of_two());
+  BOOST_TEST(!legacy.power_of_two());
+
+  for (int i = 0; i < 200; i++)
+  {
+    BOOST_TEST(pow2.insert(std::make_pair(i * 16, i)).second);
+    BOOST_TEST(legacy.insert(std::make_pair(i * 16, i)).second);
+  }
+  BOOST_TEST(pow2.size() == 200);
+  BOOST_TEST(legacy.size() == 200);
+
+  size_t capacity = static_cast< size_t >(pow2.size() / pow2.load_factor() + 0.5);
+  BOOST_TEST((capacity & (capacity - 1)) == 0);
+
+  for (int i = 0; i < 200; i++)
+  {
+    BOOST_TEST(pow2.at(i * 16) == i);
+    BOOST_TEST(legacy.at(i * 16) == i);
+  }
+
+  for (int i = 0; i < 200; i += 2)
+  {
+    pow2.erase(i * 16);
+  }
+  pow2.power_of_two(false);
+  for (int i = 0; i < 200; i++)
+  {
+    BOOST_TEST((pow2.find(i * 16) != pow2.end()) == (i % 2 == 1));
+  }
+}
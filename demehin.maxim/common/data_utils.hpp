@@ -2,6 +2,8 @@
 #define DATA_UTILS_HPP
 #include <cstddef>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace demehin::details
 {
@@ -24,6 +26,12 @@ namespace demehin::details
 
     return cpyData;
   }
+
+  template< typename T >
+  typename std::conditional< std::is_nothrow_move_assignable< T >::value, T&&, const T& >::type moveIfNoexcept(T& value) noexcept
+  {
+    return std::move(value);
+  }
 }
 
 #endif
@@ -22,7 +22,7 @@ namespace demehin
     DynamicArray(DynamicArray&&) noexcept;
 
     DynamicArray< T >& operator=(const DynamicArray< T >&);
-    DynamicArray< T >& operator=(DynamicArray< T >&&);
+    DynamicArray< T >& operator=(DynamicArray< T >&&) noexcept;
 
     T& operator[](size_t) noexcept;
     const T& operator[](size_t) const noexcept;
@@ -30,6 +30,7 @@ namespace demehin
     ~DynamicArray();
 
     void push(const T& rhs);
+    void push(T&& rhs);
 
     void pop_back();
     void pop_front();
@@ -84,8 +85,8 @@ namespace demehin
   DynamicArray< T >::DynamicArray(const DynamicArray& other):
     data_(details::copyData(other.data_ + other.begin_, other.size_)),
     size_(other.size_),
-    capacity_(other.capacity_),
-    begin_(other.begin_)
+    capacity_(other.size_),
+    begin_(0)
   {}
 
   template< typename T >
@@ -131,7 +132,7 @@ namespace demehin
   }
 
   template< typename T >
-  DynamicArray< T >& DynamicArray< T >::operator=(DynamicArray< T >&& rhs)
+  DynamicArray< T >& DynamicArray< T >::operator=(DynamicArray< T >&& rhs) noexcept
   {
     if (this != std::addressof(rhs))
     {
@@ -166,7 +167,17 @@ namespace demehin
     {
       resize();
     }
-    data_[size_++] = value;
+    data_[begin_ + size_++] = value;
+  }
+
+  template< typename T >
+  void DynamicArray< T >::push(T&& value)
+  {
+    if (size_ + begin_ >= capacity_)
+    {
+      resize();
+    }
+    data_[begin_ + size_++] = std::move(value);
   }
 
   template< typename T >
@@ -287,10 +298,24 @@ namespace demehin
   template< typename T >
   void DynamicArray< T >::resize()
   {
-    capacity_ *= 2;
-    T* newData = details::copyData(data_, capacity_);
+    size_t newCapacity = (capacity_ == 0) ? 1 : capacity_ * 2;
+    T* newData = new T[newCapacity];
+    try
+    {
+      for (size_t i = 0; i < size_; i++)
+      {
+        newData[i] = details::moveIfNoexcept(data_[begin_ + i]);
+      }
+    }
+    catch (...)
+    {
+      delete[] newData;
+      throw;
+    }
     delete[] data_;
     data_ = newData;
+    capacity_ = newCapacity;
+    begin_ = 0;
   }
 }
 
@@ -2,7 +2,6 @@
 #define LNR_ITERATOR_HPP
 #include <cassert>
 #include <tree/node.hpp>
-#include <stack.hpp>
 
 namespace demehin
 {
@@ -19,7 +18,6 @@ namespace demehin
     using Node = demehin::TreeNode< Key, T >;
     using this_t = LnrIterator< Key, T, Cmp, isConst >;
     using node_t = typename std::conditional< isConst, const Node, Node >::type;
-    using stack_t = typename std::conditional< isConst, Stack< const Node* >, Stack< Node* > >::type;
     using data_t = typename std::conditional< isConst, const std::pair< Key, T >, std::pair< Key, T > >::type;
 
     LnrIterator() noexcept;
@@ -35,21 +33,18 @@ namespace demehin
 
   private:
     node_t* node_;
-    stack_t stack_;
 
     explicit LnrIterator(node_t*) noexcept;
   };
 
   template< typename Key, typename T, typename Cmp, bool isConst >
   LnrIterator< Key, T, Cmp, isConst >::LnrIterator() noexcept:
-    node_(nullptr),
-    stack_()
+    node_(nullptr)
   {}
 
   template< typename Key, typename T, typename Cmp, bool isConst >
   LnrIterator< Key, T, Cmp, isConst >::LnrIterator(node_t* node) noexcept:
-    node_(node),
-    stack_()
+    node_(node)
   {}
 
   template< typename Key, typename T, typename Cmp, bool isConst >
@@ -62,26 +57,21 @@ namespace demehin
 
     if (node_->right != nullptr)
     {
-      stack_.push(node_);
       node_ = node_->right;
       while (node_->left != nullptr)
       {
-        stack_.push(node_);
         node_ = node_->left;
       }
     }
     else
     {
-      while (!stack_.empty() && stack_.top()->right == node_)
+      node_t* parent = node_->parent;
+      while (parent != nullptr && parent->height != -1 && parent->right == node_)
       {
-        node_ = stack_.top();
-        stack_.pop();
-      }
-      node_ = stack_.empty() ? nullptr : stack_.top();
-      if (!stack_.empty())
-      {
-        stack_.pop();
+        node_ = parent;
+        parent = parent->parent;
       }
+      node_ = (parent != nullptr && parent->height != -1) ? parent : nullptr;
     }
     return *this;
   }
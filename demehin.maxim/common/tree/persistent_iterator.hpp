@@ -0,0 +1,137 @@
+#ifndef PERSISTENT_ITERATOR_HPP
+#define PERSISTENT_ITERATOR_HPP
+#include <cassert>
+#include <memory>
+#include "persistent_node.hpp"
+
+namespace demehin
+{
+  template< typename Key, typename T, typename Cmp >
+  class PersistentTree;
+
+  template< typename Key, typename T, typename Cmp >
+  class PersistentIterator
+  {
+    friend class PersistentTree< Key, T, Cmp >;
+  public:
+    using this_t = PersistentIterator< Key, T, Cmp >;
+    using Node = demehin::PersistentNode< Key, T >;
+    using DataPair = std::pair< Key, T >;
+
+    PersistentIterator() noexcept;
+    PersistentIterator(const this_t&) noexcept;
+    this_t& operator=(const this_t&) noexcept;
+
+    this_t& operator++() noexcept;
+    this_t operator++(int) noexcept;
+
+    const DataPair& operator*() const noexcept;
+    const DataPair* operator->() const noexcept;
+
+    bool operator==(const this_t& rhs) const noexcept;
+    bool operator!=(const this_t& rhs) const noexcept;
+
+  private:
+    // an AVL tree of height 64 needs over 2^44 nodes, more than fit in a 48-bit address space
+    static constexpr size_t maxHeight = 64;
+
+    const Node* node_;
+    const Node* path_[maxHeight];
+    size_t depth_;
+
+    void pushLeft(const Node*) noexcept;
+  };
+
+  template< typename Key, typename T, typename Cmp >
+  PersistentIterator< Key, T, Cmp >::PersistentIterator() noexcept:
+    node_(nullptr),
+    depth_(0)
+  {}
+
+  template< typename Key, typename T, typename Cmp >
+  PersistentIterator< Key, T, Cmp >::PersistentIterator(const this_t& other) noexcept:
+    node_(other.node_),
+    depth_(other.depth_)
+  {
+    for (size_t i = 0; i < depth_; i++)
+    {
+      path_[i] = other.path_[i];
+    }
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentIterator< Key, T, Cmp >::this_t& PersistentIterator< Key, T, Cmp >::operator=(const this_t& rhs) noexcept
+  {
+    node_ = rhs.node_;
+    depth_ = rhs.depth_;
+    for (size_t i = 0; i < depth_; i++)
+    {
+      path_[i] = rhs.path_[i];
+    }
+    return *this;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  void PersistentIterator< Key, T, Cmp >::pushLeft(const Node* node) noexcept
+  {
+    while (node->left != nullptr)
+    {
+      assert(depth_ < maxHeight);
+      path_[depth_++] = node;
+      node = node->left;
+    }
+    node_ = node;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentIterator< Key, T, Cmp >::this_t& PersistentIterator< Key, T, Cmp >::operator++() noexcept
+  {
+    assert(node_ != nullptr);
+    if (node_->right != nullptr)
+    {
+      pushLeft(node_->right);
+    }
+    else
+    {
+      node_ = (depth_ == 0) ? nullptr : path_[--depth_];
+    }
+    return *this;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentIterator< Key, T, Cmp >::this_t PersistentIterator< Key, T, Cmp >::operator++(int) noexcept
+  {
+    assert(node_ != nullptr);
+    this_t res(*this);
+    ++(*this);
+    return res;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  const typename PersistentIterator< Key, T, Cmp >::DataPair& PersistentIterator< Key, T, Cmp >::operator*() const noexcept
+  {
+    assert(node_ != nullptr);
+    return node_->data;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  const typename PersistentIterator< Key, T, Cmp >::DataPair* PersistentIterator< Key, T, Cmp >::operator->() const noexcept
+  {
+    assert(node_ != nullptr);
+    return std::addressof(node_->data);
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  bool PersistentIterator< Key, T, Cmp >::operator==(const this_t& rhs) const noexcept
+  {
+    return node_ == rhs.node_;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  bool PersistentIterator< Key, T, Cmp >::operator!=(const this_t& rhs) const noexcept
+  {
+    return !(*this == rhs);
+  }
+}
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef PERSISTENT_NODE_HPP
+#define PERSISTENT_NODE_HPP
+#include <cstddef>
+#include <utility>
+
+namespace demehin
+{
+  template< typename Key, typename T >
+  struct PersistentNode
+  {
+    std::pair< Key, T > data;
+    PersistentNode* left;
+    PersistentNode* right;
+    int height;
+    size_t refs;
+
+    template< typename... Args >
+    explicit PersistentNode(Args&&... args);
+  };
+
+  template< typename Key, typename T >
+  template< typename... Args >
+  PersistentNode< Key, T >::PersistentNode(Args&&... args):
+    data(std::forward< Args >(args)...),
+    left(nullptr),
+    right(nullptr),
+    height(1),
+    refs(1)
+  {}
+}
+
+#endif
@@ -0,0 +1,559 @@
+#ifndef PERSISTENT_TREE_HPP
+#define PERSISTENT_TREE_HPP
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+#include "persistent_node.hpp"
+#include "persistent_iterator.hpp"
+
+namespace demehin
+{
+  template< typename Key, typename T, typename Cmp = std::less< Key > >
+  class PersistentTree
+  {
+  public:
+    using cIter = PersistentIterator< Key, T, Cmp >;
+    using Iter = cIter;
+    using DataPair = std::pair< Key, T >;
+
+    PersistentTree() noexcept;
+    PersistentTree(const PersistentTree< Key, T, Cmp >&) noexcept;
+    PersistentTree(PersistentTree< Key, T, Cmp >&&) noexcept;
+
+    template< typename InputIt >
+    PersistentTree(InputIt, InputIt);
+
+    explicit PersistentTree(std::initializer_list< DataPair >);
+
+    ~PersistentTree();
+
+    PersistentTree< Key, T, Cmp >& operator=(const PersistentTree< Key, T, Cmp >&) noexcept;
+    PersistentTree< Key, T, Cmp >& operator=(PersistentTree< Key, T, Cmp >&&) noexcept;
+
+    std::pair< cIter, bool > insert(const DataPair&);
+    template< typename InputIt >
+    void insert(InputIt, InputIt);
+
+    template< typename... Args >
+    std::pair< cIter, bool > emplace(Args&&...);
+
+    size_t erase(const Key&);
+
+    T& at(const Key&);
+    const T& at(const Key&) const;
+    T& operator[](const Key&);
+
+    cIter find(const Key&) const noexcept;
+    size_t count(const Key&) const noexcept;
+
+    cIter begin() const noexcept;
+    cIter cbegin() const noexcept;
+    cIter end() const noexcept;
+    cIter cend() const noexcept;
+
+    size_t size() const noexcept;
+    bool empty() const noexcept;
+    void clear() noexcept;
+
+    void swap(PersistentTree< Key, T, Cmp >&) noexcept;
+
+  private:
+    using Node = demehin::PersistentNode< Key, T >;
+
+    Node* root_;
+    Cmp cmp_;
+    size_t size_;
+
+    static void retain(Node*) noexcept;
+    static void release(Node*) noexcept;
+    static Node* own(Node*);
+
+    const Node* findNode(const Key&) const noexcept;
+    Node* ownPath(const Key&);
+    Node* insertAt(Node*&, DataPair&);
+    void eraseAt(Node*&, const Key&);
+    void detachMin(Node*&, Node*&);
+    static Node* replace(Node*, Node*) noexcept;
+
+    int height(const Node*) const noexcept;
+    void updateHeight(Node*) noexcept;
+    int getBalanceFactor(const Node*) const noexcept;
+    Node* rotateRight(Node*) noexcept;
+    Node* rotateLeft(Node*) noexcept;
+    Node* balance(Node*);
+  };
+
+  template< typename Key, typename T, typename Cmp >
+  PersistentTree< Key, T, Cmp >::PersistentTree() noexcept:
+    root_(nullptr),
+    cmp_(),
+    size_(0)
+  {}
+
+  template< typename Key, typename T, typename Cmp >
+  PersistentTree< Key, T, Cmp >::PersistentTree(const PersistentTree< Key, T, Cmp >& other) noexcept:
+    root_(other.root_),
+    cmp_(other.cmp_),
+    size_(other.size_)
+  {
+    retain(root_);
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  PersistentTree< Key, T, Cmp >::PersistentTree(PersistentTree< Key, T, Cmp >&& other) noexcept:
+    root_(std::exchange(other.root_, nullptr)),
+    cmp_(std::move(other.cmp_)),
+    size_(std::exchange(other.size_, 0))
+  {}
+
+  template< typename Key, typename T, typename Cmp >
+  template< typename InputIt >
+  PersistentTree< Key, T, Cmp >::PersistentTree(InputIt first, InputIt last):
+    PersistentTree()
+  {
+    insert(first, last);
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  PersistentTree< Key, T, Cmp >::PersistentTree(std::initializer_list< DataPair > ilist):
+    PersistentTree(ilist.begin(), ilist.end())
+  {}
+
+  template< typename Key, typename T, typename Cmp >
+  PersistentTree< Key, T, Cmp >::~PersistentTree()
+  {
+    release(root_);
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  PersistentTree< Key, T, Cmp >& PersistentTree< Key, T, Cmp >::operator=(const PersistentTree< Key, T, Cmp >& rhs) noexcept
+  {
+    PersistentTree< Key, T, Cmp > temp(rhs);
+    swap(temp);
+    return *this;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  PersistentTree< Key, T, Cmp >& PersistentTree< Key, T, Cmp >::operator=(PersistentTree< Key, T, Cmp >&& rhs) noexcept
+  {
+    PersistentTree< Key, T, Cmp > temp(std::move(rhs));
+    swap(temp);
+    return *this;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  void PersistentTree< Key, T, Cmp >::retain(Node* node) noexcept
+  {
+    if (node != nullptr)
+    {
+      node->refs++;
+    }
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  void PersistentTree< Key, T, Cmp >::release(Node* node) noexcept
+  {
+    while (node != nullptr && --node->refs == 0)
+    {
+      release(node->left);
+      Node* right = node->right;
+      delete node;
+      node = right;
+    }
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::Node* PersistentTree< Key, T, Cmp >::own(Node* node)
+  {
+    if (node->refs == 1)
+    {
+      return node;
+    }
+    Node* copy = new Node(node->data);
+    copy->left = node->left;
+    copy->right = node->right;
+    copy->height = node->height;
+    retain(copy->left);
+    retain(copy->right);
+    node->refs--;
+    return copy;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  const typename PersistentTree< Key, T, Cmp >::Node* PersistentTree< Key, T, Cmp >::findNode(const Key& key) const noexcept
+  {
+    const Node* node = root_;
+    while (node != nullptr)
+    {
+      if (cmp_(key, node->data.first))
+      {
+        node = node->left;
+      }
+      else if (cmp_(node->data.first, key))
+      {
+        node = node->right;
+      }
+      else
+      {
+        return node;
+      }
+    }
+    return nullptr;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::Node* PersistentTree< Key, T, Cmp >::ownPath(const Key& key)
+  {
+    Node** link = &root_;
+    while (*link != nullptr)
+    {
+      *link = own(*link);
+      Node* node = *link;
+      if (cmp_(key, node->data.first))
+      {
+        link = &node->left;
+      }
+      else if (cmp_(node->data.first, key))
+      {
+        link = &node->right;
+      }
+      else
+      {
+        return node;
+      }
+    }
+    return nullptr;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  int PersistentTree< Key, T, Cmp >::height(const Node* node) const noexcept
+  {
+    return (node == nullptr) ? 0 : node->height;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  void PersistentTree< Key, T, Cmp >::updateHeight(Node* node) noexcept
+  {
+    node->height = 1 + std::max(height(node->left), height(node->right));
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  int PersistentTree< Key, T, Cmp >::getBalanceFactor(const Node* node) const noexcept
+  {
+    return (node == nullptr) ? 0 : height(node->left) - height(node->right);
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::Node* PersistentTree< Key, T, Cmp >::rotateRight(Node* node) noexcept
+  {
+    Node* lt = node->left;
+    node->left = lt->right;
+    lt->right = node;
+    updateHeight(node);
+    updateHeight(lt);
+    return lt;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::Node* PersistentTree< Key, T, Cmp >::rotateLeft(Node* node) noexcept
+  {
+    Node* rt = node->right;
+    node->right = rt->left;
+    rt->left = node;
+    updateHeight(node);
+    updateHeight(rt);
+    return rt;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::Node* PersistentTree< Key, T, Cmp >::balance(Node* node)
+  {
+    updateHeight(node);
+    int balanceFactor = getBalanceFactor(node);
+
+    if (balanceFactor > 1)
+    {
+      node->left = own(node->left);
+      if (getBalanceFactor(node->left) < 0)
+      {
+        node->left->right = own(node->left->right);
+        node->left = rotateLeft(node->left);
+      }
+      return rotateRight(node);
+    }
+
+    if (balanceFactor < -1)
+    {
+      node->right = own(node->right);
+      if (getBalanceFactor(node->right) > 0)
+      {
+        node->right->left = own(node->right->left);
+        node->right = rotateRight(node->right);
+      }
+      return rotateLeft(node);
+    }
+
+    return node;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::Node* PersistentTree< Key, T, Cmp >::insertAt(Node*& link, DataPair& value)
+  {
+    if (link == nullptr)
+    {
+      link = new Node(std::move(value));
+      size_++;
+      return link;
+    }
+
+    link = own(link);
+    Node* node = link;
+    Node* newNode = nullptr;
+    if (cmp_(value.first, node->data.first))
+    {
+      newNode = insertAt(node->left, value);
+    }
+    else
+    {
+      newNode = insertAt(node->right, value);
+    }
+    link = balance(node);
+    return newNode;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  void PersistentTree< Key, T, Cmp >::eraseAt(Node*& link, const Key& key)
+  {
+    link = own(link);
+    Node* node = link;
+    if (cmp_(key, node->data.first))
+    {
+      eraseAt(node->left, key);
+    }
+    else if (cmp_(node->data.first, key))
+    {
+      eraseAt(node->right, key);
+    }
+    else if (node->left == nullptr || node->right == nullptr)
+    {
+      link = (node->left != nullptr) ? node->left : node->right;
+      node->left = node->right = nullptr;
+      release(node);
+      size_--;
+      return;
+    }
+    else
+    {
+      Node* next = nullptr;
+      try
+      {
+        detachMin(node->right, next);
+      }
+      catch (...)
+      {
+        if (next != nullptr)
+        {
+          link = replace(node, next);
+        }
+        throw;
+      }
+      node = replace(node, next);
+      link = node;
+    }
+    link = balance(node);
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  void PersistentTree< Key, T, Cmp >::detachMin(Node*& link, Node*& detached)
+  {
+    link = own(link);
+    Node* node = link;
+    if (node->left == nullptr)
+    {
+      link = node->right;
+      node->right = nullptr;
+      detached = node;
+      size_--;
+      return;
+    }
+    detachMin(node->left, detached);
+    link = balance(node);
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::Node* PersistentTree< Key, T, Cmp >::replace(Node* node, Node* next) noexcept
+  {
+    next->left = node->left;
+    next->right = node->right;
+    next->height = node->height;
+    node->left = node->right = nullptr;
+    release(node);
+    return next;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  template< typename... Args >
+  std::pair< typename PersistentTree< Key, T, Cmp >::cIter, bool > PersistentTree< Key, T, Cmp >::emplace(Args&&... args)
+  {
+    DataPair value(std::forward< Args >(args)...);
+    cIter pos = find(value.first);
+    if (pos != end())
+    {
+      return { pos, false };
+    }
+    const Node* newNode = insertAt(root_, value);
+    return { find(newNode->data.first), true };
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  std::pair< typename PersistentTree< Key, T, Cmp >::cIter, bool > PersistentTree< Key, T, Cmp >::insert(const DataPair& value)
+  {
+    return emplace(value);
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  template< typename InputIt >
+  void PersistentTree< Key, T, Cmp >::insert(InputIt first, InputIt last)
+  {
+    for (; first != last; first++)
+    {
+      insert(*first);
+    }
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  size_t PersistentTree< Key, T, Cmp >::erase(const Key& key)
+  {
+    if (findNode(key) == nullptr)
+    {
+      return 0;
+    }
+    eraseAt(root_, key);
+    return 1;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  T& PersistentTree< Key, T, Cmp >::at(const Key& key)
+  {
+    if (findNode(key) == nullptr)
+    {
+      throw std::out_of_range("key not found");
+    }
+    return ownPath(key)->data.second;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  const T& PersistentTree< Key, T, Cmp >::at(const Key& key) const
+  {
+    const Node* node = findNode(key);
+    if (node == nullptr)
+    {
+      throw std::out_of_range("key not found");
+    }
+    return node->data.second;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  T& PersistentTree< Key, T, Cmp >::operator[](const Key& key)
+  {
+    if (findNode(key) == nullptr)
+    {
+      emplace(key, T());
+    }
+    return ownPath(key)->data.second;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::cIter PersistentTree< Key, T, Cmp >::find(const Key& key) const noexcept
+  {
+    cIter it;
+    const Node* node = root_;
+    while (node != nullptr)
+    {
+      if (cmp_(key, node->data.first))
+      {
+        assert(it.depth_ < cIter::maxHeight);
+        it.path_[it.depth_++] = node;
+        node = node->left;
+      }
+      else if (cmp_(node->data.first, key))
+      {
+        node = node->right;
+      }
+      else
+      {
+        it.node_ = node;
+        return it;
+      }
+    }
+    return end();
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  size_t PersistentTree< Key, T, Cmp >::count(const Key& key) const noexcept
+  {
+    return (findNode(key) == nullptr) ? 0 : 1;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::cIter PersistentTree< Key, T, Cmp >::begin() const noexcept
+  {
+    cIter it;
+    if (root_ != nullptr)
+    {
+      it.pushLeft(root_);
+    }
+    return it;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::cIter PersistentTree< Key, T, Cmp >::cbegin() const noexcept
+  {
+    return begin();
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::cIter PersistentTree< Key, T, Cmp >::end() const noexcept
+  {
+    return cIter();
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename PersistentTree< Key, T, Cmp >::cIter PersistentTree< Key, T, Cmp >::cend() const noexcept
+  {
+    return end();
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  size_t PersistentTree< Key, T, Cmp >::size() const noexcept
+  {
+    return size_;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  bool PersistentTree< Key, T, Cmp >::empty() const noexcept
+  {
+    return size_ == 0;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  void PersistentTree< Key, T, Cmp >::clear() noexcept
+  {
+    release(root_);
+    root_ = nullptr;
+    size_ = 0;
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  void PersistentTree< Key, T, Cmp >::swap(PersistentTree< Key, T, Cmp >& other) noexcept
+  {
+    std::swap(root_, other.root_);
+    std::swap(cmp_, other.cmp_);
+    std::swap(size_, other.size_);
+  }
+}
+
+#endif
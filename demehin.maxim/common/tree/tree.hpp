@@ -776,13 +776,16 @@ namespace demehin
   template< typename Key, typename T, typename Cmp >
   typename Tree< Key, T, Cmp >::LnrIter Tree< Key, T, Cmp >::lnrBegin() const noexcept
   {
-    auto it = LnrIter(root_);
-    while (it.node_->left != nullptr)
+    if (root_ == fakeRoot_)
+    {
+      return lnrEnd();
+    }
+    Node* node = root_;
+    while (node->left != nullptr)
     {
-      it.stack_.push(it.node_);
-      it.node_ = it.node_->left;
+      node = node->left;
     }
-    return it;
+    return LnrIter(node);
   }
 
   template< typename Key, typename T, typename Cmp >
@@ -794,13 +797,16 @@ namespace demehin
   template< typename Key, typename T, typename Cmp >
   typename Tree< Key, T, Cmp >::cLnrIter Tree< Key, T, Cmp >::clnrBegin() const noexcept
   {
-    auto it = cLnrIter(root_);
-    while (it.node_->left != nullptr)
+    if (root_ == fakeRoot_)
+    {
+      return clnrEnd();
+    }
+    Node* node = root_;
+    while (node->left != nullptr)
     {
-      it.stack_.push(it.node_);
-      it.node_ = it.node_->left;
+      node = node->left;
     }
-    return it;
+    return cLnrIter(node);
   }
 
   template< typename Key, typename T, typename Cmp >
@@ -812,13 +818,16 @@ namespace demehin
   template< typename Key, typename T, typename Cmp >
   typename Tree< Key, T, Cmp >::RnlIter Tree< Key, T, Cmp >::rnlBegin() const noexcept
   {
-    auto it = RnlIter(root_);
-    while (it.node_->right != nullptr)
+    if (root_ == fakeRoot_)
+    {
+      return rnlEnd();
+    }
+    Node* node = root_;
+    while (node->right != nullptr)
     {
-      it.stack_.push(it.node_);
-      it.node_ = it.node_->right;
+      node = node->right;
     }
-    return it;
+    return RnlIter(node);
   }
 
   template< typename Key, typename T, typename Cmp >
@@ -830,13 +839,16 @@ namespace demehin
   template< typename Key, typename T, typename Cmp >
   typename Tree< Key, T, Cmp >::cRnlIter Tree< Key, T, Cmp >::crnlBegin() const noexcept
   {
-    auto it = cRnlIter(root_);
-    while (it.node_->right != nullptr)
+    if (root_ == fakeRoot_)
+    {
+      return crnlEnd();
+    }
+    Node* node = root_;
+    while (node->right != nullptr)
     {
-      it.stack_.push(it.node_);
-      it.node_ = it.node_->right;
+      node = node->right;
     }
-    return it;
+    return cRnlIter(node);
   }
 
   template< typename Key, typename T, typename Cmp >
@@ -915,9 +927,9 @@ namespace demehin
   template< typename Iterator, typename F >
   F Tree< Key, T, Cmp >::traverse(F f, Iterator begin, Iterator end) const
   {
-    for (auto it = begin; it != end; it++)
+    for (; begin != end; ++begin)
     {
-      f(*it);
+      f(*begin);
     }
     return f;
   }
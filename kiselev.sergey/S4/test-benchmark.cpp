@@ -0,0 +1,80 @@
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "tree.hpp"
+
+namespace
+{
+  using Clock = std::chrono::steady_clock;
+  using PoolTree = kiselev::RBTree< size_t, size_t >;
+  using HeapTree = kiselev::RBTree< size_t, size_t, std::less< size_t >, kiselev::HeapAllocator< kiselev::TreeNode< size_t, size_t > > >;
+
+  double elapsed(Clock::time_point start, size_t count)
+  {
+    std::chrono::duration< double, std::nano > time = Clock::now() - start;
+    return time.count() / count;
+  }
+
+  template< typename Tree >
+  void runTree(const char* name, const std::vector< size_t >& keys)
+  {
+    Tree tree;
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+      tree.emplace(keys[i], i);
+    }
+    double insertTime = elapsed(start, keys.size());
+
+    size_t sum = 0;
+    start = Clock::now();
+    for (typename Tree::ConstIterator it = tree.cbegin(); it != tree.cend(); ++it)
+    {
+      sum += it->second;
+    }
+    double traverseTime = elapsed(start, keys.size());
+
+    start = Clock::now();
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+      tree.erase(keys[i]);
+    }
+    double eraseTime = elapsed(start, keys.size());
+
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+      tree.emplace(keys[i], i);
+    }
+    start = Clock::now();
+    tree.clear();
+    double clearTime = elapsed(start, keys.size());
+
+    std::cout << name << '\t' << keys.size() << '\t' << insertTime << '\t' << traverseTime;
+    std::cout << '\t' << eraseTime << '\t' << clearTime << '\n';
+    BOOST_TEST(sum == keys.size() * (keys.size() - 1) / 2);
+    BOOST_TEST(tree.empty());
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(benchmark, *boost::unit_test::disabled())
+
+BOOST_AUTO_TEST_CASE(node_allocators)
+{
+  std::cout << "ns per element\nalloc\tsize\tinsert\ttraverse\terase\tclear\n";
+  std::mt19937 gen(42);
+  for (size_t size = 10000; size <= 1000000; size *= 10)
+  {
+    std::vector< size_t > keys(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+      keys[i] = i;
+    }
+    std::shuffle(keys.begin(), keys.end(), gen);
+    runTree< HeapTree >("heap", keys);
+    runTree< PoolTree >("pool", keys);
+  }
+}
+BOOST_AUTO_TEST_SUITE_END();
@@ -159,4 +159,50 @@ BOOST_AUTO_TEST_CASE(count_lowerBound_upperBound_equalRange)
   BOOST_CHECK(first == tree.equalRange(3).first);
   BOOST_CHECK(it == tree.equalRange(3).second);
 }
+
+BOOST_AUTO_TEST_CASE(node_allocators)
+{
+  RBTree< size_t, std::string > tree;
+  const std::pair< size_t, std::string >* first = std::addressof(*tree.emplace(1, "1").first);
+  tree.erase(1);
+  BOOST_TEST(tree.empty());
+  const std::pair< size_t, std::string >* second = std::addressof(*tree.emplace(2, "2").first);
+  BOOST_CHECK(first == second);
+  for (size_t i = 0; i < 1000; ++i)
+  {
+    tree.emplace(i, std::to_string(i));
+  }
+  BOOST_TEST(tree.size() == 1000);
+  for (size_t i = 0; i < 1000; ++i)
+  {
+    size_t key = i * 7919 % 1000;
+    if (key % 2 == 0)
+    {
+      tree.erase(key);
+    }
+  }
+  BOOST_TEST(tree.size() == 500);
+  BOOST_TEST(tree.at(999) == "999");
+  RBTree< size_t, std::string >::Iterator it = tree.find(501);
+  it = tree.erase(it);
+  BOOST_TEST(it->first == 503);
+  size_t expected = 1;
+  for (it = tree.begin(); it != tree.end(); ++it, expected += 2)
+  {
+    expected += expected == 501 ? 2 : 0;
+    BOOST_TEST(it->first == expected);
+  }
+  BOOST_TEST(expected == 1001);
+  tree.clear();
+  BOOST_TEST(tree.empty());
+  tree.emplace(3, "3");
+  BOOST_TEST(tree.at(3) == "3");
+
+  using HeapTree = RBTree< size_t, std::string, std::less< size_t >, HeapAllocator< TreeNode< size_t, std::string > > >;
+  HeapTree heapTree({ { 1, "1" }, { 2, "2" }, { 3, "3" } });
+  HeapTree heapCopy(heapTree);
+  heapTree.erase(2);
+  BOOST_TEST(heapTree.size() == 2);
+  BOOST_TEST(heapCopy.at(2) == "2");
+}
 BOOST_AUTO_TEST_SUITE_END();
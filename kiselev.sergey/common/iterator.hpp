@@ -6,7 +6,7 @@
 
 namespace kiselev
 {
-  template< typename Key, typename Value, typename Cmp >
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
   class RBTree;
 
   namespace detail
@@ -42,7 +42,8 @@ namespace kiselev
       bool isEnd_;
       Iterator(TreeNode< Key, Value >*, bool);
       friend class Iterator< Key, Value, Cmp, !IsConst >;
-      friend class RBTree< Key, Value, Cmp >;
+      template< typename, typename, typename, typename >
+      friend class kiselev::RBTree;
     };
 
     template< typename Key, typename Value, typename Cmp, bool IsConst >
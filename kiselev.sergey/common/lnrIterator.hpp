@@ -9,7 +9,7 @@
 #include "treeNode.hpp"
 namespace kiselev
 {
-  template< typename Key, typename Value, typename Cmp >
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
   class RBTree;
 
   namespace detail
@@ -43,7 +43,8 @@ namespace kiselev
       Stack< Node* > stack_;
       explicit LnrIterator(Node*) noexcept;
       friend class LnrIterator< Key, Value, Cmp, !IsConst >;
-      friend class RBTree< Key, Value, Cmp >;
+      template< typename, typename, typename, typename >
+      friend class kiselev::RBTree;
     };
 
     template< typename Key, typename Value, typename Cmp, bool IsConst >
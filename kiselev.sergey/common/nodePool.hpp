@@ -0,0 +1,180 @@
+#ifndef NODEPOOL_HPP
+#define NODEPOOL_HPP
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace kiselev
+{
+  template< typename T >
+  class NodePool
+  {
+  public:
+    NodePool() noexcept;
+    NodePool(const NodePool< T >&) = delete;
+    NodePool(NodePool< T >&&) noexcept;
+    ~NodePool();
+
+    NodePool< T >& operator=(const NodePool< T >&) = delete;
+    NodePool< T >& operator=(NodePool< T >&&) noexcept;
+
+    T* allocate();
+    void deallocate(T*) noexcept;
+    void clear() noexcept;
+    void swap(NodePool< T >&) noexcept;
+
+  private:
+    union Slot
+    {
+      Slot* next;
+      typename std::aligned_storage< sizeof(T), alignof(T) >::type storage;
+    };
+
+    static constexpr size_t minChunk = 16;
+    static constexpr size_t maxChunk = 4096;
+
+    Slot* chunks_;
+    Slot* free_;
+    Slot* next_;
+    Slot* end_;
+    size_t chunkSize_;
+
+    void grow();
+  };
+
+  template< typename T >
+  class HeapAllocator
+  {
+  public:
+    T* allocate();
+    void deallocate(T*) noexcept;
+    void clear() noexcept;
+    void swap(HeapAllocator< T >&) noexcept;
+  };
+
+  template< typename T >
+  constexpr size_t NodePool< T >::minChunk;
+
+  template< typename T >
+  constexpr size_t NodePool< T >::maxChunk;
+
+  template< typename T >
+  NodePool< T >::NodePool() noexcept:
+    chunks_(nullptr),
+    free_(nullptr),
+    next_(nullptr),
+    end_(nullptr),
+    chunkSize_(minChunk)
+  {}
+
+  template< typename T >
+  NodePool< T >::NodePool(NodePool< T >&& pool) noexcept:
+    chunks_(std::exchange(pool.chunks_, nullptr)),
+    free_(std::exchange(pool.free_, nullptr)),
+    next_(std::exchange(pool.next_, nullptr)),
+    end_(std::exchange(pool.end_, nullptr)),
+    chunkSize_(std::exchange(pool.chunkSize_, minChunk))
+  {}
+
+  template< typename T >
+  NodePool< T >::~NodePool()
+  {
+    clear();
+  }
+
+  template< typename T >
+  NodePool< T >& NodePool< T >::operator=(NodePool< T >&& pool) noexcept
+  {
+    NodePool< T > temp(std::move(pool));
+    swap(temp);
+    return *this;
+  }
+
+  template< typename T >
+  void NodePool< T >::grow()
+  {
+    Slot* chunk = new Slot[chunkSize_ + 1];
+    chunk->next = chunks_;
+    chunks_ = chunk;
+    next_ = chunk + 1;
+    end_ = chunk + chunkSize_ + 1;
+    if (chunkSize_ < maxChunk)
+    {
+      chunkSize_ *= 2;
+    }
+  }
+
+  template< typename T >
+  T* NodePool< T >::allocate()
+  {
+    Slot* slot = free_;
+    if (slot)
+    {
+      free_ = slot->next;
+    }
+    else
+    {
+      if (next_ == end_)
+      {
+        grow();
+      }
+      slot = next_++;
+    }
+    return static_cast< T* >(static_cast< void* >(std::addressof(slot->storage)));
+  }
+
+  template< typename T >
+  void NodePool< T >::deallocate(T* ptr) noexcept
+  {
+    Slot* slot = static_cast< Slot* >(static_cast< void* >(ptr));
+    slot->next = free_;
+    free_ = slot;
+  }
+
+  template< typename T >
+  void NodePool< T >::clear() noexcept
+  {
+    while (chunks_)
+    {
+      Slot* next = chunks_->next;
+      delete[] chunks_;
+      chunks_ = next;
+    }
+    free_ = nullptr;
+    next_ = nullptr;
+    end_ = nullptr;
+    chunkSize_ = minChunk;
+  }
+
+  template< typename T >
+  void NodePool< T >::swap(NodePool< T >& pool) noexcept
+  {
+    std::swap(chunks_, pool.chunks_);
+    std::swap(free_, pool.free_);
+    std::swap(next_, pool.next_);
+    std::swap(end_, pool.end_);
+    std::swap(chunkSize_, pool.chunkSize_);
+  }
+
+  template< typename T >
+  T* HeapAllocator< T >::allocate()
+  {
+    return static_cast< T* >(::operator new(sizeof(T)));
+  }
+
+  template< typename T >
+  void HeapAllocator< T >::deallocate(T* ptr) noexcept
+  {
+    ::operator delete(ptr);
+  }
+
+  template< typename T >
+  void HeapAllocator< T >::clear() noexcept
+  {}
+
+  template< typename T >
+  void HeapAllocator< T >::swap(HeapAllocator< T >&) noexcept
+  {}
+}
+#endif
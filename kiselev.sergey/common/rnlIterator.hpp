@@ -10,7 +10,7 @@
 
 namespace kiselev
 {
-  template< typename Key, typename Value, typename Cmp >
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
   class RBTree;
 
   namespace detail
@@ -44,7 +44,8 @@ namespace kiselev
       Stack< Node* > stack_;
       explicit RnlIterator(Node*) noexcept;
       friend class RnlIterator< Key, Value, Cmp, !IsConst >;
-      friend class RBTree< Key, Value, Cmp >;
+      template< typename, typename, typename, typename >
+      friend class kiselev::RBTree;
     };
 
     template< typename Key, typename Value, typename Cmp, bool IsConst >
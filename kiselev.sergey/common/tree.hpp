@@ -9,10 +9,11 @@
 #include "rnlIterator.hpp"
 #include "breadthIterator.hpp"
 #include "treeNode.hpp"
+#include "nodePool.hpp"
 
 namespace kiselev
 {
-  template< typename Key, typename Value, typename Cmp = std::less< Key > >
+  template< typename Key, typename Value, typename Cmp = std::less< Key >, typename Alloc = NodePool< TreeNode< Key, Value > > >
   class RBTree
   {
   public:
@@ -29,16 +30,16 @@ namespace kiselev
     using ConstIteratorPair = std::pair< ConstIterator, ConstIterator >;
 
     RBTree();
-    RBTree(const RBTree< Key, Value, Cmp >&);
-    RBTree(RBTree< Key, Value, Cmp >&&) noexcept;
+    RBTree(const RBTree< Key, Value, Cmp, Alloc >&);
+    RBTree(RBTree< Key, Value, Cmp, Alloc >&&) noexcept;
     RBTree(std::initializer_list< value >);
     template< typename InputIt >
     RBTree(InputIt first, InputIt last);
     ~RBTree();
 
-    RBTree< Key, Value, Cmp >& operator=(const RBTree< Key, Value, Cmp >&);
-    RBTree< Key, Value, Cmp >& operator=(RBTree< Key, Value, Cmp >&&) noexcept;
-    RBTree< Key, Value, Cmp >& operator=(std::initializer_list< value >);
+    RBTree< Key, Value, Cmp, Alloc >& operator=(const RBTree< Key, Value, Cmp, Alloc >&);
+    RBTree< Key, Value, Cmp, Alloc >& operator=(RBTree< Key, Value, Cmp, Alloc >&&) noexcept;
+    RBTree< Key, Value, Cmp, Alloc >& operator=(std::initializer_list< value >);
     Value& operator[](const Key&);
     const Value& operator[](const Key&) const;
 
@@ -94,7 +95,7 @@ namespace kiselev
     template< typename... Args >
     Iterator emplaceHint(ConstIterator, Args&&...);
 
-    void swap(RBTree< Key, Value, Cmp >&) noexcept;
+    void swap(RBTree< Key, Value, Cmp, Alloc >&) noexcept;
     void clear() noexcept;
 
     Iterator find(const Key&) noexcept;
@@ -115,20 +116,24 @@ namespace kiselev
     void rotateLeft(Node* node) noexcept;
     void rotateRight(Node* node) noexcept;
     void fixInsert(Node* node) noexcept;
-    void fixDelete(Node* node) noexcept;
+    void fixDelete(Node* node, Node* parent) noexcept;
+    template< typename... Args >
+    Node* createNode(Color, Node*, Args&&...);
+    void destroyNode(Node*) noexcept;
     Node* root_;
     Cmp cmp_;
     size_t size_;
+    Alloc alloc_;
   };
 
-  template< typename Key, typename Value, typename Cmp >
-  RBTree< Key, Value, Cmp >::RBTree():
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  RBTree< Key, Value, Cmp, Alloc >::RBTree():
     root_(nullptr),
     size_(0)
   {}
 
-  template< typename Key, typename Value, typename Cmp >
-  RBTree< Key, Value, Cmp >::RBTree(const RBTree< Key, Value, Cmp >& tree):
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  RBTree< Key, Value, Cmp, Alloc >::RBTree(const RBTree< Key, Value, Cmp, Alloc >& tree):
     RBTree()
   {
     for (ConstIterator it = tree.cbegin(); it != tree.cend(); ++it)
@@ -137,15 +142,16 @@ namespace kiselev
     }
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  RBTree< Key, Value, Cmp >::RBTree(RBTree< Key, Value, Cmp >&& tree) noexcept:
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  RBTree< Key, Value, Cmp, Alloc >::RBTree(RBTree< Key, Value, Cmp, Alloc >&& tree) noexcept:
     root_(std::exchange(tree.root_, nullptr)),
-    size_(std::exchange(tree.size_, 0))
+    size_(std::exchange(tree.size_, 0)),
+    alloc_(std::move(tree.alloc_))
   {}
 
-  template< typename Key, typename Value, typename Cmp >
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
   template< typename InputIt >
-  RBTree< Key, Value, Cmp >::RBTree(InputIt first, InputIt last):
+  RBTree< Key, Value, Cmp, Alloc >::RBTree(InputIt first, InputIt last):
     RBTree()
   {
     for (; first != last; first++)
@@ -153,49 +159,101 @@ namespace kiselev
       insert(*first);
     }
   }
-  template< typename Key, typename Value, typename Cmp >
-  RBTree< Key, Value, Cmp >::RBTree(std::initializer_list< value > il):
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  RBTree< Key, Value, Cmp, Alloc >::RBTree(std::initializer_list< value > il):
     RBTree(il.begin(), il.end())
   {}
 
-  template< typename Key, typename Value, typename Cmp >
-  RBTree< Key, Value, Cmp >& RBTree< Key, Value, Cmp >::operator=(const RBTree< Key, Value, Cmp >& tree)
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  RBTree< Key, Value, Cmp, Alloc >& RBTree< Key, Value, Cmp, Alloc >::operator=(const RBTree< Key, Value, Cmp, Alloc >& tree)
   {
-    RBTree< Key, Value, Cmp > cpy(tree);
+    RBTree< Key, Value, Cmp, Alloc > cpy(tree);
     swap(cpy);
     return *this;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  RBTree< Key, Value, Cmp >& RBTree< Key, Value, Cmp >::operator=(RBTree< Key, Value, Cmp >&& tree) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  RBTree< Key, Value, Cmp, Alloc >& RBTree< Key, Value, Cmp, Alloc >::operator=(RBTree< Key, Value, Cmp, Alloc >&& tree) noexcept
   {
-    RBTree< Key, Value, Cmp > temp(std::move(tree));
+    RBTree< Key, Value, Cmp, Alloc > temp(std::move(tree));
     swap(temp);
     return *this;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  RBTree< Key, Value, Cmp >& RBTree< Key, Value, Cmp >::operator=(std::initializer_list< value > il)
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  RBTree< Key, Value, Cmp, Alloc >& RBTree< Key, Value, Cmp, Alloc >::operator=(std::initializer_list< value > il)
   {
-    RBTree< Key, Value, Cmp > temp(il);
+    RBTree< Key, Value, Cmp, Alloc > temp(il);
     swap(temp);
     return *this;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  RBTree< Key, Value, Cmp >::~RBTree()
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  RBTree< Key, Value, Cmp, Alloc >::~RBTree()
   {
     clear();
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  void RBTree< Key, Value, Cmp >::clear() noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  void RBTree< Key, Value, Cmp, Alloc >::clear() noexcept
+  {
+    Node* node = root_;
+    while (node)
+    {
+      if (node->left)
+      {
+        node = node->left;
+      }
+      else if (node->right)
+      {
+        node = node->right;
+      }
+      else
+      {
+        Node* parent = node->parent;
+        if (parent && parent->left == node)
+        {
+          parent->left = nullptr;
+        }
+        else if (parent)
+        {
+          parent->right = nullptr;
+        }
+        destroyNode(node);
+        node = parent;
+      }
+    }
+    root_ = nullptr;
+    size_ = 0;
+    alloc_.clear();
+  }
+
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  template< typename... Args >
+  typename RBTree< Key, Value, Cmp, Alloc >::Node* RBTree< Key, Value, Cmp, Alloc >::createNode(Color color, Node* parent, Args&&... args)
+  {
+    Node* node = alloc_.allocate();
+    try
+    {
+      new (node) Node{ color, nullptr, nullptr, parent, { std::forward< Args >(args)... } };
+    }
+    catch (...)
+    {
+      alloc_.deallocate(node);
+      throw;
+    }
+    return node;
+  }
+
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  void RBTree< Key, Value, Cmp, Alloc >::destroyNode(Node* node) noexcept
   {
-    erase(begin(), end());
+    node->~Node();
+    alloc_.deallocate(node);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  void RBTree< Key, Value, Cmp >::rotateLeft(Node* node) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  void RBTree< Key, Value, Cmp, Alloc >::rotateLeft(Node* node) noexcept
   {
     Node* child = node->right;
     node->right = child->left;
@@ -220,8 +278,8 @@ namespace kiselev
     node->parent = child;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  void RBTree< Key, Value, Cmp >::rotateRight(Node* node) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  void RBTree< Key, Value, Cmp, Alloc >::rotateRight(Node* node) noexcept
   {
     Node* child = node->left;
     node->left = child->right;
@@ -246,8 +304,8 @@ namespace kiselev
     node->parent = child;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  void RBTree< Key, Value, Cmp >::fixInsert(Node* node) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  void RBTree< Key, Value, Cmp, Alloc >::fixInsert(Node* node) noexcept
   {
     Node* parent = nullptr;
     Node* grandParent = nullptr;
@@ -305,82 +363,72 @@ namespace kiselev
     root_->color = Color::BLACK;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  void RBTree< Key, Value, Cmp >::fixDelete(Node* node) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  void RBTree< Key, Value, Cmp, Alloc >::fixDelete(Node* node, Node* parent) noexcept
   {
-    while (node != root_ && node->color == Color::BLACK)
+    while (node != root_ && (!node || node->color == Color::BLACK))
     {
-      if (node == node->parent->left)
+      if (node == parent->left)
       {
-        Node* brother = node->parent->right;
-        if (brother && brother->color == Color::RED)
+        Node* brother = parent->right;
+        if (brother->color == Color::RED)
         {
           brother->color = Color::BLACK;
-          node->parent->color = Color::RED;
-          rotateLeft(node->parent);
-          brother = node->parent->right;
+          parent->color = Color::RED;
+          rotateLeft(parent);
+          brother = parent->right;
         }
         if ((!brother->left || brother->left->color == Color::BLACK) && (!brother->right || brother->right->color == Color::BLACK))
         {
           brother->color = Color::RED;
-          node = node->parent;
+          node = parent;
+          parent = node->parent;
         }
         else
         {
           if (!brother->right || brother->right->color == Color::BLACK)
           {
-            if (brother->left)
-            {
-              brother->left->color = Color::BLACK;
-            }
+            brother->left->color = Color::BLACK;
             brother->color = Color::RED;
             rotateRight(brother);
-            brother = node->parent->right;
+            brother = parent->right;
           }
-          brother->color = node->parent->color;
-          node->parent->color = Color::BLACK;
-          if (brother->right)
-          {
-            brother->right->color = Color::BLACK;
-          }
-          rotateLeft(node->parent);
+          brother->color = parent->color;
+          parent->color = Color::BLACK;
+          brother->right->color = Color::BLACK;
+          rotateLeft(parent);
           node = root_;
         }
       }
       else
       {
-        Node* brother = node->parent->left;
-        if (brother && brother->color == Color::RED)
+        Node* brother = parent->left;
+        if (brother->color == Color::RED)
         {
           brother->color = Color::BLACK;
-          node->parent->color = Color::RED;
-          rotateRight(node->parent);
-          brother = node->parent->left;
+          parent->color = Color::RED;
+          rotateRight(parent);
+          brother = parent->left;
         }
         if ((!brother->left || brother->left->color == Color::BLACK) && (!brother->right || brother->right->color == Color::BLACK))
         {
           brother->color = Color::RED;
-          node = node->parent;
+          node = parent;
+          parent = node->parent;
         }
         else
         {
           if (!brother->left || brother->left->color == Color::BLACK)
           {
-            if (brother->right)
-            {
-              brother->right->color = Color::BLACK;
-            }
+            brother->right->color = Color::BLACK;
             brother->color = Color::RED;
             rotateLeft(brother);
-            brother = node->parent->left;
-          }
-          brother->color = node->parent->color;
-          node->parent->color = Color::BLACK;
-          if (brother->left)
-          {
-            brother->left->color = Color::BLACK;
+            brother = parent->left;
           }
-          rotateRight(node->parent);
+          brother->color = parent->color;
+          parent->color = Color::BLACK;
+          brother->left->color = Color::BLACK;
+          rotateRight(parent);
           node = root_;
         }
       }
@@ -391,27 +439,28 @@ namespace kiselev
     }
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  size_t RBTree< Key, Value, Cmp >::size() const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  size_t RBTree< Key, Value, Cmp, Alloc >::size() const noexcept
   {
     return size_;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  bool RBTree< Key, Value, Cmp >::empty() const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  bool RBTree< Key, Value, Cmp, Alloc >::empty() const noexcept
   {
     return size_ == 0;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  void RBTree< Key, Value, Cmp >::swap(RBTree< Key, Value, Cmp >& tree) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  void RBTree< Key, Value, Cmp, Alloc >::swap(RBTree< Key, Value, Cmp, Alloc >& tree) noexcept
   {
     std::swap(root_, tree.root_);
     std::swap(size_, tree.size_);
+    alloc_.swap(tree.alloc_);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::begin() noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::Iterator RBTree< Key, Value, Cmp, Alloc >::begin() noexcept
   {
     if (empty())
     {
@@ -425,8 +474,8 @@ namespace kiselev
     return Iterator(temp, false);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::ConstIterator RBTree< Key, Value, Cmp >::cbegin() const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::ConstIterator RBTree< Key, Value, Cmp, Alloc >::cbegin() const noexcept
   {
     if (empty())
     {
@@ -440,8 +489,8 @@ namespace kiselev
     return ConstIterator(temp, false);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::end() noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::Iterator RBTree< Key, Value, Cmp, Alloc >::end() noexcept
   {
     if (empty())
     {
@@ -455,8 +504,8 @@ namespace kiselev
     return Iterator(temp, true);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::ConstIterator RBTree< Key, Value, Cmp >::cend() const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::ConstIterator RBTree< Key, Value, Cmp, Alloc >::cend() const noexcept
   {
     if (empty())
     {
@@ -470,8 +519,8 @@ namespace kiselev
     return ConstIterator(temp, true);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp>::LnrIterator RBTree< Key, Value, Cmp >::lnrBegin()
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::LnrIterator RBTree< Key, Value, Cmp, Alloc >::lnrBegin()
   {
     if (empty())
     {
@@ -486,8 +535,8 @@ namespace kiselev
     return it;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::ConstLnrIterator RBTree< Key, Value, Cmp >::lnrCbegin() const
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::ConstLnrIterator RBTree< Key, Value, Cmp, Alloc >::lnrCbegin() const
   {
     if (empty())
     {
@@ -502,20 +551,20 @@ namespace kiselev
     return it;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::LnrIterator RBTree< Key, Value, Cmp >::lnrEnd() noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::LnrIterator RBTree< Key, Value, Cmp, Alloc >::lnrEnd() noexcept
   {
     return LnrIterator(nullptr);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::ConstLnrIterator RBTree< Key, Value, Cmp >::lnrCend() const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::ConstLnrIterator RBTree< Key, Value, Cmp, Alloc >::lnrCend() const noexcept
   {
     return ConstLnrIterator(nullptr);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::RnlIterator RBTree< Key, Value, Cmp >::rnlBegin()
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::RnlIterator RBTree< Key, Value, Cmp, Alloc >::rnlBegin()
   {
     if (empty())
     {
@@ -530,8 +579,8 @@ namespace kiselev
     return it;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::ConstRnlIterator RBTree< Key, Value, Cmp >::rnlCbegin() const
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::ConstRnlIterator RBTree< Key, Value, Cmp, Alloc >::rnlCbegin() const
   {
     if (empty())
     {
@@ -546,45 +595,45 @@ namespace kiselev
     return it;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::RnlIterator RBTree< Key, Value, Cmp >::rnlEnd() noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::RnlIterator RBTree< Key, Value, Cmp, Alloc >::rnlEnd() noexcept
   {
     return RnlIterator(nullptr);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::ConstRnlIterator RBTree< Key, Value, Cmp >::rnlCend() const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::ConstRnlIterator RBTree< Key, Value, Cmp, Alloc >::rnlCend() const noexcept
   {
     return ConstRnlIterator(nullptr);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::BreadthIterator RBTree< Key, Value, Cmp >::breadthBegin() noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::BreadthIterator RBTree< Key, Value, Cmp, Alloc >::breadthBegin() noexcept
   {
     return BreadthIterator(root_);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::ConstBreadthIterator RBTree< Key, Value, Cmp >::breadthCbegin() const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::ConstBreadthIterator RBTree< Key, Value, Cmp, Alloc >::breadthCbegin() const noexcept
   {
     return ConstBreadthIterator(root_);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::BreadthIterator RBTree< Key, Value, Cmp >::breadthEnd() noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::BreadthIterator RBTree< Key, Value, Cmp, Alloc >::breadthEnd() noexcept
   {
     return BreadthIterator(nullptr);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::ConstBreadthIterator RBTree< Key, Value, Cmp >::breadthCend() const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::ConstBreadthIterator RBTree< Key, Value, Cmp, Alloc >::breadthCend() const noexcept
   {
     return ConstBreadthIterator(nullptr);
   }
 
-  template< typename Key, typename Value, typename Cmp >
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
   template< typename F >
-  F RBTree< Key, Value, Cmp >::traverse_lnr(F f) const
+  F RBTree< Key, Value, Cmp, Alloc >::traverse_lnr(F f) const
   {
     for (ConstLnrIterator it = lnrCbegin(); it != lnrCend(); ++it)
     {
@@ -593,9 +642,9 @@ namespace kiselev
     return f;
   }
 
-  template< typename Key, typename Value, typename Cmp >
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
   template< typename F >
-  F RBTree< Key, Value, Cmp >::traverse_rnl(F f) const
+  F RBTree< Key, Value, Cmp, Alloc >::traverse_rnl(F f) const
   {
     for (ConstRnlIterator it = rnlCbegin(); it != rnlCend(); ++it)
     {
@@ -604,9 +653,9 @@ namespace kiselev
     return f;
   }
 
-  template< typename Key, typename Value, typename Cmp >
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
   template< typename F >
-  F RBTree< Key, Value, Cmp >::traverse_breadth(F f) const
+  F RBTree< Key, Value, Cmp, Alloc >::traverse_breadth(F f) const
   {
     for (ConstBreadthIterator it = breadthCbegin(); it != breadthCend(); ++it)
     {
@@ -615,8 +664,8 @@ namespace kiselev
     return f;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::find(const Key& key) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::Iterator RBTree< Key, Value, Cmp, Alloc >::find(const Key& key) noexcept
   {
     Node* temp = root_;
     while (temp)
@@ -637,8 +686,8 @@ namespace kiselev
     return end();
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::ConstIterator RBTree< Key, Value, Cmp >::find(const Key& key) const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::ConstIterator RBTree< Key, Value, Cmp, Alloc >::find(const Key& key) const noexcept
   {
     Node* temp = root_;
     while (temp)
@@ -659,11 +708,11 @@ namespace kiselev
     return cend();
   }
 
-  template< typename Key, typename Value, typename Cmp >
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
   template< typename... Args >
-  std::pair< typename RBTree< Key, Value, Cmp >::Iterator, bool > RBTree< Key, Value, Cmp >::emplace(Args &&... args)
+  std::pair< typename RBTree< Key, Value, Cmp, Alloc >::Iterator, bool > RBTree< Key, Value, Cmp, Alloc >::emplace(Args &&... args)
   {
-    Node* newNode = new Node{ Color::BLACK, nullptr, nullptr, nullptr, { std::forward< Args >(args)... } };
+    Node* newNode = createNode(Color::BLACK, nullptr, std::forward< Args >(args)...);
     try
     {
       if (!root_)
@@ -687,7 +736,7 @@ namespace kiselev
         }
         else
         {
-          delete newNode;
+          destroyNode(newNode);
           return { Iterator(temp, false), false };
         }
       }
@@ -705,7 +754,7 @@ namespace kiselev
     }
     catch (...)
     {
-      delete newNode;
+      destroyNode(newNode);
       throw;
     }
     fixInsert(newNode);
@@ -713,16 +762,16 @@ namespace kiselev
     return { Iterator(newNode, false), true };
   }
 
-  template< typename Key, typename Value, typename Cmp >
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
   template< typename... Args >
-  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::emplaceHint(ConstIterator hint, Args &&... args)
+  typename RBTree< Key, Value, Cmp, Alloc >::Iterator RBTree< Key, Value, Cmp, Alloc >::emplaceHint(ConstIterator hint, Args &&... args)
   {
     if (hint == cend() || empty())
     {
       return emplace(std::forward< Args >(args)...).first;
     }
     Node* pos = hint.node_;
-    Node* newNode = new Node{ Color::RED, nullptr, nullptr, pos, { std::forward< Args >(args)... } };
+    Node* newNode = createNode(Color::RED, pos, std::forward< Args >(args)...);
     value val = newNode->data;
     try
     {
@@ -748,55 +797,55 @@ namespace kiselev
       }
       else
       {
-        delete newNode;
+        destroyNode(newNode);
         return Iterator(pos, false);
       }
-      delete newNode;
+      destroyNode(newNode);
       return emplace(val).first;
     }
     catch (...)
     {
-      delete newNode;
+      destroyNode(newNode);
       throw;
     }
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  std::pair< typename RBTree< Key, Value, Cmp >::Iterator, bool > RBTree< Key, Value, Cmp >::insert(const value& val)
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  std::pair< typename RBTree< Key, Value, Cmp, Alloc >::Iterator, bool > RBTree< Key, Value, Cmp, Alloc >::insert(const value& val)
   {
     return emplace(val);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  std::pair< typename RBTree< Key, Value, Cmp >::Iterator, bool > RBTree< Key, Value, Cmp >::insert(value& val)
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  std::pair< typename RBTree< Key, Value, Cmp, Alloc >::Iterator, bool > RBTree< Key, Value, Cmp, Alloc >::insert(value& val)
   {
     return emplace(val);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  std::pair< typename RBTree< Key, Value, Cmp >::Iterator, bool > RBTree< Key, Value, Cmp >::insert(value&& val)
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  std::pair< typename RBTree< Key, Value, Cmp, Alloc >::Iterator, bool > RBTree< Key, Value, Cmp, Alloc >::insert(value&& val)
   {
     return emplace(std::move(val));
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::insert(ConstIterator pos, const value& val)
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::Iterator RBTree< Key, Value, Cmp, Alloc >::insert(ConstIterator pos, const value& val)
   {
     return emplaceHint(pos, val);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::insert(Iterator pos, const value& val)
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::Iterator RBTree< Key, Value, Cmp, Alloc >::insert(Iterator pos, const value& val)
   {
     ConstIterator it(pos);
     return emplaceHint(it, val);
   }
 
-  template< typename Key, typename Value, typename Cmp >
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
   template< typename InputIt >
-  void RBTree< Key, Value, Cmp >::insert(InputIt first, InputIt last)
+  void RBTree< Key, Value, Cmp, Alloc >::insert(InputIt first, InputIt last)
   {
-    RBTree< Key, Value, Cmp > temp(*this);
+    RBTree< Key, Value, Cmp, Alloc > temp(*this);
     for (; first != last; ++first)
     {
       temp.insert(*first);
@@ -804,14 +853,14 @@ namespace kiselev
     swap(temp);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  void RBTree< Key, Value, Cmp >::insert(std::initializer_list< value > il)
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  void RBTree< Key, Value, Cmp, Alloc >::insert(std::initializer_list< value > il)
   {
     insert(il.begin(), il.end());
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::erase(ConstIterator pos) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::Iterator RBTree< Key, Value, Cmp, Alloc >::erase(ConstIterator pos) noexcept
   {
     if (pos == cend())
     {
@@ -822,7 +871,8 @@ namespace kiselev
     Node* child = nullptr;
     if (size_ == 1)
     {
-      delete root_;
+      destroyNode(root_);
+      root_ = nullptr;
       size_ = 0;
       return end();
     }
@@ -838,6 +888,12 @@ namespace kiselev
         replace = replace->left;
       }
     }
+    Iterator next(toDelete, false);
+    if (replace == toDelete)
+    {
+      ++next;
+    }
+    Node* parent = replace->parent;
     child = replace->left ? replace->left : replace->right;
     if (child)
     {
@@ -861,24 +917,22 @@ namespace kiselev
     }
     if (replace->color == Color::BLACK)
     {
-      fixDelete(child ? child : replace->parent);
+      fixDelete(child, parent);
     }
-    Iterator next(pos.node_, pos.isEnd_);
-    ++next;
-    delete replace;
+    destroyNode(replace);
     --size_;
-    return next;
+    return next.isEnd_ ? end() : next;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::erase(Iterator pos) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::Iterator RBTree< Key, Value, Cmp, Alloc >::erase(Iterator pos) noexcept
   {
     ConstIterator it(pos);
     return erase(it);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  size_t RBTree< Key, Value, Cmp >::erase(const Key& key) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  size_t RBTree< Key, Value, Cmp, Alloc >::erase(const Key& key) noexcept
   {
     Iterator it = find(key);
     if (it == end())
@@ -889,33 +943,33 @@ namespace kiselev
     return 1;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::erase(ConstIterator first, ConstIterator last) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::Iterator RBTree< Key, Value, Cmp, Alloc >::erase(ConstIterator first, ConstIterator last) noexcept
   {
-    while (first != last)
+    while (first != last && !empty())
     {
       first = erase(first);
     }
     return Iterator(last.node_, last.isEnd_);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::erase(Iterator first, Iterator last) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::Iterator RBTree< Key, Value, Cmp, Alloc >::erase(Iterator first, Iterator last) noexcept
   {
     ConstIterator constFirst(first);
     ConstIterator constLast(last);
     return erase(constFirst, constLast);
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  size_t RBTree< Key, Value, Cmp >::count(const Key& key) const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  size_t RBTree< Key, Value, Cmp, Alloc >::count(const Key& key) const noexcept
   {
     ConstIterator it = find(key);
     return it == cend() ? 0 : 1;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::lowerBound(const Key& key) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::Iterator RBTree< Key, Value, Cmp, Alloc >::lowerBound(const Key& key) noexcept
   {
     Node* temp = root_;
     Node* res = nullptr;
@@ -934,14 +988,14 @@ namespace kiselev
     return res ? Iterator(res, false) : end();
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::ConstIterator RBTree< Key, Value, Cmp >::lowerBound(const Key& key) const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::ConstIterator RBTree< Key, Value, Cmp, Alloc >::lowerBound(const Key& key) const noexcept
   {
     return ConstIterator(lowerBound(key));
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::Iterator RBTree< Key, Value, Cmp >::upperBound(const Key& key) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::Iterator RBTree< Key, Value, Cmp, Alloc >::upperBound(const Key& key) noexcept
   {
     Node* temp = root_;
     Node* res = nullptr;
@@ -960,40 +1014,40 @@ namespace kiselev
     return res ? Iterator(res, false) : end();
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::ConstIterator RBTree< Key, Value, Cmp >::upperBound(const Key& key) const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::ConstIterator RBTree< Key, Value, Cmp, Alloc >::upperBound(const Key& key) const noexcept
   {
     return ConstIterator(upperBound(key));
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::IteratorPair RBTree< Key, Value, Cmp >::equalRange(const Key& key) noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::IteratorPair RBTree< Key, Value, Cmp, Alloc >::equalRange(const Key& key) noexcept
   {
     return { Iterator(lowerBound(key)), Iterator(upperBound(key)) };
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  typename RBTree< Key, Value, Cmp >::ConstIteratorPair RBTree< Key, Value, Cmp >::equalRange(const Key& key) const noexcept
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  typename RBTree< Key, Value, Cmp, Alloc >::ConstIteratorPair RBTree< Key, Value, Cmp, Alloc >::equalRange(const Key& key) const noexcept
   {
     return { ConstIterator(lowerBound(key)), ConstIterator(upperBound(key)) };
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  const Value& RBTree< Key, Value, Cmp >::operator[](const Key& key) const
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  const Value& RBTree< Key, Value, Cmp, Alloc >::operator[](const Key& key) const
   {
     ConstIterator it = find(key);
     return it->second;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  Value& RBTree< Key, Value, Cmp >::operator[](const Key& key)
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  Value& RBTree< Key, Value, Cmp, Alloc >::operator[](const Key& key)
   {
     Iterator it = insert(std::make_pair(key, Value())).first;
     return it->second;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  const Value& RBTree< Key, Value, Cmp >::at(const Key& key) const
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  const Value& RBTree< Key, Value, Cmp, Alloc >::at(const Key& key) const
   {
     ConstIterator it = find(key);
     if (it == cend())
@@ -1003,10 +1057,10 @@ namespace kiselev
     return it->second;
   }
 
-  template< typename Key, typename Value, typename Cmp >
-  Value& RBTree< Key, Value, Cmp >::at(const Key& key)
+  template< typename Key, typename Value, typename Cmp, typename Alloc >
+  Value& RBTree< Key, Value, Cmp, Alloc >::at(const Key& key)
   {
-    return const_cast< Value& >(static_cast< const RBTree< Key, Value, Cmp >& >(*this).at(key));
+    return const_cast< Value& >(static_cast< const RBTree< Key, Value, Cmp, Alloc >& >(*this).at(key));
   }
 }
 #endif
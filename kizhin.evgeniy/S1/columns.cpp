@@ -0,0 +1,136 @@
+#include "columns.hpp"
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <stdexcept>
+
+kizhin::SequenceColumns::SequenceColumns():
+  offsets_{ 0 },
+  rowOffsets_{ 0 }
+{}
+
+kizhin::SequenceColumns::SequenceColumns(const ForwardList< NumbersT >& source):
+  SequenceColumns()
+{
+  for (const auto& nums: source) {
+    addSequence();
+    for (const auto& num: nums) {
+      addNumber(num);
+    }
+  }
+}
+
+void kizhin::SequenceColumns::addSequence()
+{
+  offsets_.pushBack(numbers_.size());
+}
+
+void kizhin::SequenceColumns::addNumber(const value_type num)
+{
+  assert(sequences() != 0);
+  numbers_.pushBack(num);
+  ++offsets_.back();
+}
+
+kizhin::SequenceColumns::size_type kizhin::SequenceColumns::sequences() const noexcept
+{
+  return offsets_.size() - 1;
+}
+
+kizhin::SequenceColumns::size_type kizhin::SequenceColumns::numbers() const noexcept
+{
+  return numbers_.size();
+}
+
+void kizhin::SequenceColumns::transpose()
+{
+  const size_type* const offsets = offsets_.begin();
+  const size_type count = sequences();
+  size_type longest = 0;
+  for (size_type i = 0; i != count; ++i) {
+    longest = std::max(longest, offsets[i + 1] - offsets[i]);
+  }
+  Buffer< size_type > rowOffsets(longest + 1, 0);
+  size_type* const cursors = rowOffsets.begin();
+  for (size_type i = 0; i != count; ++i) {
+    ++cursors[offsets[i + 1] - offsets[i]];
+  }
+  size_type longer = 0;
+  for (size_type length = longest; length != 0; --length) {
+    longer += cursors[length];
+    cursors[length] = longer;
+  }
+  for (size_type row = 0, begin = 0; row != longest; ++row) {
+    const size_type rowSize = cursors[row + 1];
+    cursors[row] = begin;
+    begin += rowSize;
+  }
+  cursors[longest] = numbers_.size();
+
+  Buffer< value_type > rows(numbers_.size());
+  Buffer< value_type > sums(longest, 0);
+  Buffer< bool > overflows(longest, false);
+  constexpr value_type limit = std::numeric_limits< value_type >::max();
+  value_type* const out = rows.begin();
+  value_type* const rowSums = sums.begin();
+  bool* const rowOverflows = overflows.begin();
+  const value_type* const in = numbers_.begin();
+  for (size_type i = 0; i != count; ++i) {
+    const size_type length = offsets[i + 1] - offsets[i];
+    const value_type* const sequence = in + offsets[i];
+    for (size_type row = 0; row != length; ++row) {
+      const value_type num = sequence[row];
+      out[cursors[row]++] = num;
+      rowOverflows[row] = rowOverflows[row] || rowSums[row] > limit - num;
+      rowSums[row] += num;
+    }
+  }
+  for (size_type row = longest; row != 0; --row) {
+    cursors[row] = cursors[row - 1];
+  }
+  cursors[0] = 0;
+
+  rows_.swap(rows);
+  rowOffsets_.swap(rowOffsets);
+  sums_.swap(sums);
+  overflows_.swap(overflows);
+}
+
+kizhin::SequenceColumns::size_type kizhin::SequenceColumns::rows() const noexcept
+{
+  return rowOffsets_.size() - 1;
+}
+
+kizhin::SequenceColumns::const_iterator kizhin::SequenceColumns::rowBegin(
+    const size_type row) const noexcept
+{
+  assert(row < rows());
+  return rows_.begin() + rowOffsets_.begin()[row];
+}
+
+kizhin::SequenceColumns::const_iterator kizhin::SequenceColumns::rowEnd(
+    const size_type row) const noexcept
+{
+  assert(row < rows());
+  return rows_.begin() + rowOffsets_.begin()[row + 1];
+}
+
+kizhin::SequenceColumns::value_type kizhin::SequenceColumns::rowSum(
+    const size_type row) const
+{
+  assert(row < rows());
+  if (overflows_.begin()[row]) {
+    throw std::overflow_error("Failed to compute sum because of an overflow");
+  }
+  return sums_.begin()[row];
+}
+
+kizhin::ForwardList< kizhin::NumbersT > kizhin::SequenceColumns::rowLists() const
+{
+  ForwardList< NumbersT > result;
+  for (size_type row = 0; row != rows(); ++row) {
+    result.emplaceBack(rowBegin(row), rowEnd(row));
+  }
+  return result;
+}
+
@@ -0,0 +1,46 @@
+#ifndef SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_S1_COLUMNS_HPP
+#define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_S1_COLUMNS_HPP
+
+#include <buffer.hpp>
+#include <forward-list.hpp>
+#include "type-utils.hpp"
+
+namespace kizhin {
+  class SequenceColumns;
+}
+
+class kizhin::SequenceColumns final
+{
+public:
+  using value_type = NumbersT::value_type;
+  using size_type = std::size_t;
+  using const_iterator = Buffer< value_type >::const_iterator;
+
+  SequenceColumns();
+  explicit SequenceColumns(const ForwardList< NumbersT >&);
+
+  void addSequence();
+  void addNumber(value_type);
+
+  size_type sequences() const noexcept;
+  size_type numbers() const noexcept;
+
+  void transpose();
+
+  size_type rows() const noexcept;
+  const_iterator rowBegin(size_type) const noexcept;
+  const_iterator rowEnd(size_type) const noexcept;
+  value_type rowSum(size_type) const;
+  ForwardList< NumbersT > rowLists() const;
+
+private:
+  Buffer< value_type > numbers_;
+  Buffer< size_type > offsets_;
+  Buffer< value_type > rows_;
+  Buffer< size_type > rowOffsets_;
+  Buffer< value_type > sums_;
+  Buffer< bool > overflows_;
+};
+
+#endif
+
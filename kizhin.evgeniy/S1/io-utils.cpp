@@ -16,3 +16,20 @@ std::istream& kizhin::inputSequences(std::istream& in, NamesT& names,
   return in;
 }
 
+std::istream& kizhin::inputSequences(std::istream& in, NamesT& names,
+    SequenceColumns& columns)
+{
+  NamesT::value_type currName;
+  while (in >> currName) {
+    names.pushBack(currName);
+    columns.addSequence();
+    using IstremIterT = std::istream_iterator< NumbersT::value_type >;
+    for (IstremIterT i(in), end{}; i != end; ++i) {
+      columns.addNumber(*i);
+    }
+    in.clear();
+  }
+  in.clear();
+  return in;
+}
+
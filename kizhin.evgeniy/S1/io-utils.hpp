@@ -3,23 +3,33 @@
 
 #include <iostream>
 #include <forward-list.hpp>
+#include "columns.hpp"
 #include "type-utils.hpp"
 
 namespace kizhin {
   std::istream& inputSequences(std::istream&, NamesT&, ForwardList< NumbersT >&);
+  std::istream& inputSequences(std::istream&, NamesT&, SequenceColumns&);
   template < typename T >
   std::ostream& outputList(std::ostream&, const ForwardList< T >&);
+  template < typename ForwardIt >
+  std::ostream& outputRange(std::ostream&, ForwardIt, ForwardIt);
 }
 
 template < typename T >
 std::ostream& kizhin::outputList(std::ostream& out, const ForwardList< T >& list)
 {
-  if (list.empty()) {
+  return outputRange(out, list.begin(), list.end());
+}
+
+template < typename ForwardIt >
+std::ostream& kizhin::outputRange(std::ostream& out, ForwardIt first, const ForwardIt last)
+{
+  if (first == last) {
     return out;
   }
-  out << list.front();
-  for (auto i = ++list.begin(), end = list.end(); i != end; ++i) {
-    out << ' ' << *i;
+  out << *first;
+  for (++first; first != last; ++first) {
+    out << ' ' << *first;
   }
   return out;
 }
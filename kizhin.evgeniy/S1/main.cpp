@@ -1,33 +1,30 @@
-#include <algorithm>
 #include <stdexcept>
 #include "io-utils.hpp"
-#include "list-utils.hpp"
+#include "columns.hpp"
 
 int main()
 {
   using namespace kizhin;
   try {
     NamesT names;
-    ForwardList< NumbersT > numbers;
-    if (!inputSequences(std::cin, names, numbers)) {
+    SequenceColumns columns;
+    if (!inputSequences(std::cin, names, columns)) {
       throw std::logic_error("Failed to input");
     }
-    numbers = transpose(numbers);
+    columns.transpose();
     outputList(std::cout, names);
     if (!names.empty()) {
       std::cout << '\n';
     }
-    if (names.empty() || std::all_of(numbers.begin(), numbers.end(), is_empty_list{})) {
+    if (names.empty() || columns.rows() == 0) {
       std::cout << "0\n";
       return 0;
     }
     ForwardList< NumbersT::value_type > sums;
-    for (const auto& num: numbers) {
-      outputList(std::cout, num);
-      if (!num.empty()) {
-        std::cout << '\n';
-      }
-      sums.pushBack(safeAccumulate(num));
+    for (std::size_t row = 0; row != columns.rows(); ++row) {
+      outputRange(std::cout, columns.rowBegin(row), columns.rowEnd(row));
+      std::cout << '\n';
+      sums.pushBack(columns.rowSum(row));
     }
     outputList(std::cout, sums);
     if (!sums.empty()) {
@@ -0,0 +1,71 @@
+#include <chrono>
+#include <iostream>
+#include <boost/test/unit_test.hpp>
+#include "columns.hpp"
+#include "list-utils.hpp"
+
+namespace {
+  using Clock = std::chrono::steady_clock;
+  using kizhin::NumbersT;
+
+  template < typename F >
+  double measureNs(std::size_t iterations, F&& function)
+  {
+    const auto start = Clock::now();
+    for (std::size_t i = 0; i != iterations; ++i) {
+      function(i);
+    }
+    const std::chrono::duration< double, std::nano > elapsed = Clock::now() - start;
+    return elapsed.count() / iterations;
+  }
+
+  kizhin::ForwardList< NumbersT > generateSequences(std::size_t count, std::size_t length)
+  {
+    kizhin::ForwardList< NumbersT > result;
+    for (std::size_t i = 0; i != count; ++i) {
+      NumbersT nums;
+      const std::size_t currLength = length - i % 2;
+      for (std::size_t j = 0; j != currLength; ++j) {
+        nums.pushBack(i * 31 + j);
+      }
+      result.pushBack(std::move(nums));
+    }
+    return result;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(benchmark, *boost::unit_test::disabled());
+
+BOOST_AUTO_TEST_CASE(transpose_and_sum)
+{
+  constexpr std::size_t total = 10000000;
+  std::cout << "sequences\tlength\tlists ns/number\tcolumns ns/number\n";
+  for (std::size_t length = 10; length <= 10000; length *= 10) {
+    const std::size_t count = total / length;
+    const kizhin::ForwardList< NumbersT > source = generateSequences(count, length);
+    kizhin::SequenceColumns columns(source);
+    NumbersT::value_type listsSum = 0;
+    NumbersT::value_type columnsSum = 0;
+    const auto lists = [&](std::size_t)
+    {
+      const kizhin::ForwardList< NumbersT > rows = kizhin::transpose(source);
+      for (const auto& nums: rows) {
+        listsSum += kizhin::safeAccumulate(nums);
+      }
+    };
+    const auto arena = [&](std::size_t)
+    {
+      columns.transpose();
+      for (std::size_t row = 0; row != columns.rows(); ++row) {
+        columnsSum += columns.rowSum(row);
+      }
+    };
+    const double listsNs = measureNs(1, lists) / columns.numbers();
+    const double columnsNs = measureNs(1, arena) / columns.numbers();
+    std::cout << count << '\t' << length << '\t' << listsNs << '\t' << columnsNs << '\n';
+    BOOST_TEST(listsSum == columnsSum);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END();
+
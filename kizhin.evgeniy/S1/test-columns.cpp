@@ -0,0 +1,84 @@
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <boost/test/unit_test.hpp>
+#include "columns.hpp"
+#include "io-utils.hpp"
+#include "list-utils.hpp"
+
+using kizhin::NumbersT;
+
+BOOST_AUTO_TEST_SUITE(sequence_columns);
+
+BOOST_AUTO_TEST_CASE(empty_input)
+{
+  kizhin::SequenceColumns columns;
+  columns.transpose();
+  BOOST_TEST(columns.sequences() == 0);
+  BOOST_TEST(columns.rows() == 0);
+  BOOST_TEST(columns.rowLists().empty());
+}
+
+BOOST_AUTO_TEST_CASE(empty_sequences)
+{
+  kizhin::SequenceColumns columns;
+  columns.addSequence();
+  columns.addSequence();
+  columns.transpose();
+  BOOST_TEST(columns.sequences() == 2);
+  BOOST_TEST(columns.rows() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(rows_and_sums)
+{
+  std::istringstream in("first 1 2 3\nsecond\nthird 4 5\nfourth 6 7 8 9");
+  kizhin::NamesT names;
+  kizhin::SequenceColumns columns;
+  kizhin::inputSequences(in, names, columns);
+  BOOST_TEST(names.size() == 4);
+  BOOST_TEST(columns.sequences() == 4);
+  BOOST_TEST(columns.numbers() == 9);
+  columns.transpose();
+  const kizhin::ForwardList< NumbersT > expected{ { 1, 4, 6 }, { 2, 5, 7 }, { 3, 8 }, { 9 } };
+  BOOST_TEST((columns.rowLists() == expected));
+  const NumbersT::value_type sums[] = { 11, 14, 11, 9 };
+  for (std::size_t row = 0; row != columns.rows(); ++row) {
+    BOOST_TEST(columns.rowSum(row) == sums[row]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(sum_overflow)
+{
+  constexpr NumbersT::value_type limit = std::numeric_limits< NumbersT::value_type >::max();
+  const kizhin::ForwardList< NumbersT > source{ { limit, 1 }, { 1, 1 } };
+  kizhin::SequenceColumns columns(source);
+  columns.transpose();
+  BOOST_CHECK_THROW(columns.rowSum(0), std::overflow_error);
+  BOOST_TEST(columns.rowSum(1) == 2);
+}
+
+BOOST_AUTO_TEST_CASE(matches_list_transpose)
+{
+  std::mt19937 engine(7);
+  kizhin::ForwardList< NumbersT > source;
+  for (std::size_t i = 0; i != 200; ++i) {
+    NumbersT nums;
+    const std::size_t length = engine() % 30;
+    for (std::size_t j = 0; j != length; ++j) {
+      nums.pushBack(engine() % 1000);
+    }
+    source.pushBack(nums);
+  }
+  kizhin::SequenceColumns columns(source);
+  columns.transpose();
+  const kizhin::ForwardList< NumbersT > expected = kizhin::transpose(source);
+  BOOST_TEST((columns.rowLists() == expected));
+  std::size_t row = 0;
+  for (const auto& nums: expected) {
+    BOOST_TEST(columns.rowSum(row++) == kizhin::safeAccumulate(nums));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END();
+
@@ -0,0 +1,97 @@
+#include "compiled-expression.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+kizhin::CompiledExpression::CompiledExpression() noexcept:
+  depth_(0)
+{}
+
+kizhin::CompiledExpression::CompiledExpression(Queue< Token > tokens):
+  depth_(0)
+{
+  size_type depth = 0;
+  size_type maxDepth = 0;
+  while (!tokens.empty()) {
+    const Token token = tokens.front();
+    tokens.pop();
+    if (token.type() == TokenType::number) {
+      code_.pushBack({ TokenType::number, OperationCode{}, token.number() });
+      maxDepth = std::max(maxDepth, ++depth);
+    } else if (token.type() == TokenType::operation) {
+      if (depth < 2) {
+        throw std::logic_error("Not enough operands");
+      }
+      code_.pushBack({ TokenType::operation, token.operation()->code(), 0 });
+      --depth;
+    } else {
+      throw std::logic_error("Unexpected token type");
+    }
+  }
+  if (depth != 1) {
+    throw std::logic_error("Invalid expression");
+  }
+  depth_ = maxDepth;
+}
+
+kizhin::CompiledExpression::size_type kizhin::CompiledExpression::size() const noexcept
+{
+  return code_.size();
+}
+
+kizhin::CompiledExpression::size_type kizhin::CompiledExpression::stackDepth() const
+    noexcept
+{
+  return depth_;
+}
+
+kizhin::CompiledExpression::number_type kizhin::CompiledExpression::evaluate() const
+{
+  Buffer< number_type > operands(depth_);
+  return evaluate(operands);
+}
+
+kizhin::CompiledExpression::number_type kizhin::CompiledExpression::evaluate(
+    Buffer< number_type >& operands) const
+{
+  if (code_.empty()) {
+    throw std::logic_error("Invalid expression");
+  }
+  if (operands.size() < depth_) {
+    operands.assign(depth_);
+  }
+  number_type* top = operands.begin();
+  for (const Instruction& instruction: code_) {
+    if (instruction.type == TokenType::number) {
+      *(top++) = instruction.number;
+    } else {
+      --top;
+      *(top - 1) = apply(instruction.operation, *(top - 1), *top);
+    }
+  }
+  return *operands.begin();
+}
+
+void kizhin::CompiledExpression::swap(CompiledExpression& rhs) noexcept
+{
+  code_.swap(rhs.code_);
+  std::swap(depth_, rhs.depth_);
+}
+
+kizhin::CompiledExpression::number_type kizhin::CompiledExpression::apply(
+    const OperationCode operation, const number_type lhs, const number_type rhs)
+{
+  switch (operation) {
+  case OperationCode::addition:
+    return Addition::apply(lhs, rhs);
+  case OperationCode::subtraction:
+    return Subtraction::apply(lhs, rhs);
+  case OperationCode::multiplication:
+    return Multiplication::apply(lhs, rhs);
+  case OperationCode::division:
+    return Division::apply(lhs, rhs);
+  case OperationCode::modulus:
+    return Modulus::apply(lhs, rhs);
+  }
+  throw std::logic_error("Unknown operation");
+}
+
@@ -0,0 +1,44 @@
+#ifndef SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_S2_COMPILED_EXPRESSION_HPP
+#define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_S2_COMPILED_EXPRESSION_HPP
+
+#include <buffer.hpp>
+#include <queue.hpp>
+#include "token.hpp"
+
+namespace kizhin {
+  class CompiledExpression;
+}
+
+class kizhin::CompiledExpression final
+{
+public:
+  using number_type = Token::number_type;
+  using size_type = std::size_t;
+
+  CompiledExpression() noexcept;
+  explicit CompiledExpression(Queue< Token >);
+
+  size_type size() const noexcept;
+  size_type stackDepth() const noexcept;
+
+  number_type evaluate() const;
+  number_type evaluate(Buffer< number_type >& operands) const;
+
+  void swap(CompiledExpression&) noexcept;
+
+private:
+  struct Instruction
+  {
+    TokenType type;
+    OperationCode operation;
+    number_type number;
+  };
+
+  Buffer< Instruction > code_;
+  size_type depth_;
+
+  static number_type apply(OperationCode, number_type, number_type);
+};
+
+#endif
+
@@ -0,0 +1,179 @@
+#include "expression-reader.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include "io-utils.hpp"
+
+namespace kizhin {
+  bool isSpace(char) noexcept;
+  bool isDigit(char) noexcept;
+  const char* skipSpaces(const char*, const char*) noexcept;
+  bool readNumber(const char*&, const char*, bool, Token::number_type&) noexcept;
+  bool readToken(const char*&, const char*, Token&);
+}
+
+kizhin::ExpressionReader::ExpressionReader(std::istream& in, const size_type chunkSize):
+  in_(in),
+  buffer_(chunkSize),
+  begin_(0),
+  end_(0),
+  chunkSize_(chunkSize)
+{
+  assert(chunkSize != 0 && "ExpressionReader: zero chunk size");
+}
+
+bool kizhin::ExpressionReader::next(PostfixExpression& expression)
+{
+  const char* first = nullptr;
+  const char* last = nullptr;
+  while (nextLine(first, last)) {
+    if (first != last) {
+      expression = parseLine(first, last);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool kizhin::ExpressionReader::nextLine(const char*& first, const char*& last)
+{
+  size_type scanned = 0;
+  while (true) {
+    const char* data = buffer_.begin();
+    const size_type unscanned = end_ - begin_ - scanned;
+    const void* found = std::memchr(data + begin_ + scanned, '\n', unscanned);
+    if (found) {
+      first = data + begin_;
+      last = static_cast< const char* >(found);
+      begin_ = last - data + 1;
+      return true;
+    }
+    scanned = end_ - begin_;
+    if (!fill()) {
+      if (begin_ == end_) {
+        return false;
+      }
+      first = buffer_.begin() + begin_;
+      last = buffer_.begin() + end_;
+      begin_ = end_;
+      return true;
+    }
+  }
+}
+
+bool kizhin::ExpressionReader::fill()
+{
+  char* data = buffer_.begin();
+  if (begin_ != 0) {
+    std::copy(data + begin_, data + end_, data);
+    end_ -= begin_;
+    begin_ = 0;
+  }
+  if (end_ + chunkSize_ > buffer_.size()) {
+    Buffer< char > expanded(std::max(buffer_.size() * 2, end_ + chunkSize_));
+    std::copy(data, data + end_, expanded.begin());
+    buffer_.swap(expanded);
+    data = buffer_.begin();
+  }
+  in_.read(data + end_, chunkSize_);
+  const size_type count = in_.gcount();
+  end_ += count;
+  return count != 0;
+}
+
+kizhin::PostfixExpression kizhin::ExpressionReader::parseLine(const char* first,
+    const char* last)
+{
+  PostfixBuilder builder;
+  Token token;
+  while (readToken(first, last, token)) {
+    builder.push(token);
+  }
+  return builder.release();
+}
+
+bool kizhin::isSpace(const char symbol) noexcept
+{
+  return std::isspace(static_cast< unsigned char >(symbol));
+}
+
+bool kizhin::isDigit(const char symbol) noexcept
+{
+  return std::isdigit(static_cast< unsigned char >(symbol));
+}
+
+const char* kizhin::skipSpaces(const char* first, const char* last) noexcept
+{
+  while (first != last && isSpace(*first)) {
+    ++first;
+  }
+  return first;
+}
+
+bool kizhin::readNumber(const char*& current, const char* last, const bool negative,
+    Token::number_type& value) noexcept
+{
+  using number_type = Token::number_type;
+  using unsigned_type = std::uint64_t;
+  if (current == last || !isDigit(*current)) {
+    return false;
+  }
+  const unsigned_type maxValue = std::numeric_limits< number_type >::max();
+  const unsigned_type limit = negative ? maxValue + 1 : maxValue;
+  unsigned_type result = 0;
+  for (; current != last && isDigit(*current); ++current) {
+    const unsigned_type digit = *current - '0';
+    if (result > (limit - digit) / 10) {
+      return false;
+    }
+    result = result * 10 + digit;
+  }
+  if (!negative) {
+    value = static_cast< number_type >(result);
+  } else if (result == limit) {
+    value = std::numeric_limits< number_type >::min();
+  } else {
+    value = -static_cast< number_type >(result);
+  }
+  return true;
+}
+
+bool kizhin::readToken(const char*& current, const char* last, Token& token)
+{
+  current = skipSpaces(current, last);
+  if (current == last) {
+    return false;
+  }
+  Token::number_type value = 0;
+  if (isDigit(*current)) {
+    if (!readNumber(current, last, false, value)) {
+      return false;
+    }
+    token = Token(value);
+    return true;
+  }
+  const char symbol = *(current++);
+  if (symbol == '(') {
+    current = skipSpaces(current, last);
+    if (current != last && *current == '-') {
+      ++current;
+      if (!readNumber(current, last, true, value)) {
+        return false;
+      }
+      current = skipSpaces(current, last);
+      if (current == last || *current != ')') {
+        return false;
+      }
+      ++current;
+      token = Token(value);
+      return true;
+    }
+  }
+  token = constructToken(symbol);
+  return token.type() != TokenType::unknown;
+}
+
@@ -0,0 +1,35 @@
+#ifndef SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_S2_EXPRESSION_READER_HPP
+#define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_S2_EXPRESSION_READER_HPP
+
+#include <iosfwd>
+#include <buffer.hpp>
+#include "postfix-expression.hpp"
+
+namespace kizhin {
+  class ExpressionReader;
+}
+
+class kizhin::ExpressionReader final
+{
+public:
+  using size_type = std::size_t;
+  static constexpr size_type defaultChunkSize = 1 << 16;
+
+  explicit ExpressionReader(std::istream&, size_type = defaultChunkSize);
+
+  bool next(PostfixExpression&);
+
+private:
+  std::istream& in_;
+  Buffer< char > buffer_;
+  size_type begin_;
+  size_type end_;
+  size_type chunkSize_;
+
+  bool nextLine(const char*&, const char*&);
+  bool fill();
+  static PostfixExpression parseLine(const char*, const char*);
+};
+
+#endif
+
@@ -1,12 +1,6 @@
 #include "io-utils.hpp"
 #include <cassert>
 #include <iostream>
-#include <queue.hpp>
-#include <stack.hpp>
-
-namespace kizhin {
-  Token constructToken(char);
-}
 
 kizhin::StreamGuard::StreamGuard(std::basic_ios< char >& s):
   s_(s),
@@ -65,44 +59,54 @@ kizhin::PostfixExpression kizhin::inputPostfixExpression(std::istream& in)
   if (!s) {
     return PostfixExpression(Queue< Token >());
   }
-  Stack< Token > operations;
-  Queue< Token > expression;
+  PostfixBuilder builder;
   Token token;
   while (in >> token) {
-    if (token.type() == TokenType::number) {
-      expression.push(token);
-    } else if (token.type() == TokenType::bracket) {
-      BracketType br = token.bracket();
-      if (br == BracketType::opening) {
-        operations.push(token);
-      } else {
-        while (!operations.empty() && operations.top().type() != TokenType::bracket) {
-          expression.push(operations.top());
-          operations.pop();
-        }
-        if (!operations.empty()) {
-          operations.pop();
-        }
+    builder.push(token);
+  }
+  return builder.release();
+}
+
+void kizhin::PostfixBuilder::push(const Token& token)
+{
+  if (token.type() == TokenType::number) {
+    expression_.push(token);
+  } else if (token.type() == TokenType::bracket) {
+    if (token.bracket() == BracketType::opening) {
+      operations_.push(token);
+    } else {
+      while (!operations_.empty() && operations_.top().type() != TokenType::bracket) {
+        expression_.push(operations_.top());
+        operations_.pop();
+      }
+      if (!operations_.empty()) {
+        operations_.pop();
       }
-    } else if (token.type() == TokenType::operation) {
-      const BinaryOperation* currOp = token.operation();
-      while (!operations.empty() && operations.top().type() == TokenType::operation) {
-        const BinaryOperation* stackOp = operations.top().operation();
-        if (stackOp->precedence() >= currOp->precedence()) {
-          expression.push(operations.top());
-          operations.pop();
-        } else {
-          break;
-        }
+    }
+  } else if (token.type() == TokenType::operation) {
+    const BinaryOperation* currOp = token.operation();
+    while (!operations_.empty() && operations_.top().type() == TokenType::operation) {
+      const BinaryOperation* stackOp = operations_.top().operation();
+      if (stackOp->precedence() >= currOp->precedence()) {
+        expression_.push(operations_.top());
+        operations_.pop();
+      } else {
+        break;
       }
-      operations.push(token);
     }
+    operations_.push(token);
   }
-  while (!operations.empty()) {
-    expression.push(operations.top());
-    operations.pop();
+}
+
+kizhin::PostfixExpression kizhin::PostfixBuilder::release()
+{
+  while (!operations_.empty()) {
+    expression_.push(operations_.top());
+    operations_.pop();
   }
-  return PostfixExpression(expression);
+  Queue< Token > expression;
+  expression.swap(expression_);
+  return PostfixExpression(std::move(expression));
 }
 
 kizhin::Token kizhin::constructToken(const char symbol)
@@ -2,12 +2,16 @@
 #define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_S2_IO_UTILS_HPP
 
 #include <ios>
+#include <queue.hpp>
+#include <stack.hpp>
 #include "postfix-expression.hpp"
 
 namespace kizhin {
   std::istream& operator>>(std::istream&, Token&);
   PostfixExpression inputPostfixExpression(std::istream&);
   class StreamGuard;
+  class PostfixBuilder;
+  Token constructToken(char);
 }
 
 class kizhin::StreamGuard
@@ -24,5 +28,16 @@ private:
   std::basic_ios< char >::fmtflags flags_;
 };
 
+class kizhin::PostfixBuilder final
+{
+public:
+  void push(const Token&);
+  PostfixExpression release();
+
+private:
+  Stack< Token > operations_;
+  Queue< Token > expression_;
+};
+
 #endif
 
@@ -1,9 +1,9 @@
 #include <fstream>
 #include <iostream>
-#include <sstream>
 #include <stdexcept>
+#include <buffer.hpp>
 #include <forward-list.hpp>
-#include "io-utils.hpp"
+#include "expression-reader.hpp"
 #include "postfix-expression.hpp"
 
 int main(int argc, char** argv)
@@ -23,13 +23,12 @@ int main(int argc, char** argv)
       }
     }
     std::istream& in = fin.is_open() ? fin : std::cin;
-    std::string current;
+    ExpressionReader reader(in);
+    PostfixExpression current(Queue< Token >{});
     ForwardList< PostfixExpression::number_type > results;
-    while (std::getline(in, current)) {
-      if (!current.empty()) {
-        std::stringstream stream(current);
-        results.pushFront(inputPostfixExpression(stream).evaluate());
-      }
+    Buffer< PostfixExpression::number_type > operands;
+    while (reader.next(current)) {
+      results.pushFront(current.evaluate(operands));
     }
     if (!results.empty()) {
       std::cout << results.front();
@@ -4,6 +4,12 @@
 
 kizhin::BinaryOperation::number_type kizhin::Addition::eval(const number_type lhs,
     const number_type rhs) const
+{
+  return apply(lhs, rhs);
+}
+
+kizhin::BinaryOperation::number_type kizhin::Addition::apply(const number_type lhs,
+    const number_type rhs)
 {
   if (rhs > 0 && lhs > std::numeric_limits< number_type >::max() - rhs) {
     throw std::overflow_error("Addition overflow");
@@ -19,6 +25,11 @@ kizhin::OperationPrecedence kizhin::Addition::precedence() const noexcept
   return OperationPrecedence::addition;
 }
 
+kizhin::OperationCode kizhin::Addition::code() const noexcept
+{
+  return OperationCode::addition;
+}
+
 kizhin::Addition& kizhin::Addition::instance() noexcept
 {
   static Addition instance;
@@ -27,6 +38,12 @@ kizhin::Addition& kizhin::Addition::instance() noexcept
 
 kizhin::BinaryOperation::number_type kizhin::Subtraction::eval(const number_type lhs,
     const number_type rhs) const
+{
+  return apply(lhs, rhs);
+}
+
+kizhin::BinaryOperation::number_type kizhin::Subtraction::apply(const number_type lhs,
+    const number_type rhs)
 {
   if (rhs > 0 && lhs < std::numeric_limits< number_type >::min() + rhs) {
     throw std::underflow_error("Substraction underflow");
@@ -42,6 +59,11 @@ kizhin::OperationPrecedence kizhin::Subtraction::precedence() const noexcept
   return OperationPrecedence::subtraction;
 }
 
+kizhin::OperationCode kizhin::Subtraction::code() const noexcept
+{
+  return OperationCode::subtraction;
+}
+
 kizhin::Subtraction& kizhin::Subtraction::instance() noexcept
 {
   static Subtraction instance;
@@ -50,6 +72,12 @@ kizhin::Subtraction& kizhin::Subtraction::instance() noexcept
 
 kizhin::BinaryOperation::number_type kizhin::Multiplication::eval(const number_type lhs,
     const number_type rhs) const
+{
+  return apply(lhs, rhs);
+}
+
+kizhin::BinaryOperation::number_type kizhin::Multiplication::apply(const number_type lhs,
+    const number_type rhs)
 {
   if (rhs == 0) {
     return 0;
@@ -68,6 +96,11 @@ kizhin::OperationPrecedence kizhin::Multiplication::precedence() const noexcept
   return OperationPrecedence::multiplication;
 }
 
+kizhin::OperationCode kizhin::Multiplication::code() const noexcept
+{
+  return OperationCode::multiplication;
+}
+
 kizhin::Multiplication& kizhin::Multiplication::instance() noexcept
 {
   static Multiplication instance;
@@ -76,6 +109,12 @@ kizhin::Multiplication& kizhin::Multiplication::instance() noexcept
 
 kizhin::BinaryOperation::number_type kizhin::Division::eval(const number_type lhs,
     const number_type rhs) const
+{
+  return apply(lhs, rhs);
+}
+
+kizhin::BinaryOperation::number_type kizhin::Division::apply(const number_type lhs,
+    const number_type rhs)
 {
   if (rhs == 0) {
     throw std::logic_error("Division by zero");
@@ -88,6 +127,11 @@ kizhin::OperationPrecedence kizhin::Division::precedence() const noexcept
   return OperationPrecedence::division;
 }
 
+kizhin::OperationCode kizhin::Division::code() const noexcept
+{
+  return OperationCode::division;
+}
+
 kizhin::Division& kizhin::Division::instance() noexcept
 {
   static Division instance;
@@ -96,6 +140,12 @@ kizhin::Division& kizhin::Division::instance() noexcept
 
 kizhin::BinaryOperation::number_type kizhin::Modulus::eval(const number_type lhs,
     const number_type rhs) const
+{
+  return apply(lhs, rhs);
+}
+
+kizhin::BinaryOperation::number_type kizhin::Modulus::apply(const number_type lhs,
+    const number_type rhs)
 {
   if (rhs == 0) {
     throw std::logic_error("Modulus by zero");
@@ -112,6 +162,11 @@ kizhin::OperationPrecedence kizhin::Modulus::precedence() const noexcept
   return OperationPrecedence::modulus;
 }
 
+kizhin::OperationCode kizhin::Modulus::code() const noexcept
+{
+  return OperationCode::modulus;
+}
+
 kizhin::Modulus& kizhin::Modulus::instance() noexcept
 {
   static Modulus instance;
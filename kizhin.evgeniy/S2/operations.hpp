@@ -5,6 +5,7 @@
 
 namespace kizhin {
   enum class OperationPrecedence;
+  enum class OperationCode;
   class BinaryOperation;
 
   class Addition;
@@ -22,6 +23,14 @@ enum class kizhin::OperationPrecedence {
   modulus = 100,
 };
 
+enum class kizhin::OperationCode {
+  addition,
+  subtraction,
+  multiplication,
+  division,
+  modulus,
+};
+
 class kizhin::BinaryOperation
 {
 public:
@@ -33,6 +42,7 @@ public:
   BinaryOperation& operator=(const BinaryOperation&) = delete;
   virtual number_type eval(number_type, number_type) const = 0;
   virtual OperationPrecedence precedence() const noexcept = 0;
+  virtual OperationCode code() const noexcept = 0;
 };
 
 class kizhin::Addition: public BinaryOperation
@@ -40,6 +50,8 @@ class kizhin::Addition: public BinaryOperation
 public:
   number_type eval(number_type, number_type) const override;
   OperationPrecedence precedence() const noexcept override;
+  OperationCode code() const noexcept override;
+  static number_type apply(number_type, number_type);
   static Addition& instance() noexcept;
 
 private:
@@ -51,6 +63,8 @@ class kizhin::Subtraction: public BinaryOperation
 public:
   number_type eval(number_type, number_type) const override;
   OperationPrecedence precedence() const noexcept override;
+  OperationCode code() const noexcept override;
+  static number_type apply(number_type, number_type);
   static Subtraction& instance() noexcept;
 
 private:
@@ -62,6 +76,8 @@ class kizhin::Multiplication: public BinaryOperation
 public:
   number_type eval(number_type, number_type) const override;
   OperationPrecedence precedence() const noexcept override;
+  OperationCode code() const noexcept override;
+  static number_type apply(number_type, number_type);
   static Multiplication& instance() noexcept;
 
 private:
@@ -73,6 +89,8 @@ class kizhin::Division: public BinaryOperation
 public:
   number_type eval(number_type, number_type) const override;
   OperationPrecedence precedence() const noexcept override;
+  OperationCode code() const noexcept override;
+  static number_type apply(number_type, number_type);
   static Division& instance() noexcept;
 
 private:
@@ -84,6 +102,8 @@ class kizhin::Modulus: public BinaryOperation
 public:
   number_type eval(number_type, number_type) const override;
   OperationPrecedence precedence() const noexcept override;
+  OperationCode code() const noexcept override;
+  static number_type apply(number_type, number_type);
   static Modulus& instance() noexcept;
 
 private:
@@ -1,9 +1,19 @@
 #include "postfix-expression.hpp"
 #include <stdexcept>
-#include <stack.hpp>
+
+namespace {
+  kizhin::CompiledExpression compileTokens(const kizhin::Queue< kizhin::Token >& tokens)
+  {
+    if (tokens.empty()) {
+      return kizhin::CompiledExpression();
+    }
+    return kizhin::CompiledExpression(tokens);
+  }
+}
 
 kizhin::PostfixExpression::PostfixExpression(Queue< Token > tokens):
-  tokens_(std::move(tokens))
+  tokens_(std::move(tokens)),
+  compiled_(compileTokens(tokens_))
 {}
 
 kizhin::PostfixExpression& kizhin::PostfixExpression::operator+=(
@@ -46,30 +56,21 @@ bool kizhin::PostfixExpression::empty() const noexcept
 
 kizhin::PostfixExpression::number_type kizhin::PostfixExpression::evaluate() const
 {
-  Queue< Token > tokens = tokens_;
-  Stack< number_type > operands;
-  while (!tokens.empty()) {
-    const Token token = tokens.front();
-    tokens.pop();
-    if (token.type() == TokenType::number) {
-      operands.push(token.number());
-    } else if (token.type() == TokenType::operation) {
-      if (operands.size() < 2) {
-        throw std::logic_error("Not enough operands");
-      }
-      const number_type right = operands.top();
-      operands.pop();
-      const number_type left = operands.top();
-      operands.pop();
-      operands.push(token.operation()->eval(left, right));
-    } else {
-      throw std::logic_error("Unexpected token type");
-    }
-  }
-  if (operands.size() != 1) {
+  return compiled_.evaluate();
+}
+
+kizhin::PostfixExpression::number_type kizhin::PostfixExpression::evaluate(
+    Buffer< number_type >& operands) const
+{
+  return compiled_.evaluate(operands);
+}
+
+kizhin::CompiledExpression kizhin::PostfixExpression::compile() const
+{
+  if (tokens_.empty()) {
     throw std::logic_error("Invalid expression");
   }
-  return operands.top();
+  return compiled_;
 }
 
 void kizhin::PostfixExpression::clear() noexcept
@@ -77,11 +78,13 @@ void kizhin::PostfixExpression::clear() noexcept
   while (!tokens_.empty()) {
     tokens_.pop();
   }
+  CompiledExpression().swap(compiled_);
 }
 
 void kizhin::PostfixExpression::swap(PostfixExpression& rhs) noexcept
 {
   tokens_.swap(rhs.tokens_);
+  compiled_.swap(rhs.compiled_);
 }
 
 void kizhin::PostfixExpression::appendExpression(const PostfixExpression& rhs,
@@ -94,7 +97,9 @@ void kizhin::PostfixExpression::appendExpression(const PostfixExpression& rhs,
     rhsTokens.pop();
   }
   newTokens.emplace(operation);
+  CompiledExpression newCompiled(newTokens);
   using std::swap;
   swap(newTokens, tokens_);
+  compiled_.swap(newCompiled);
 }
 
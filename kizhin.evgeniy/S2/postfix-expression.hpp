@@ -2,6 +2,7 @@
 #define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_S2_POSTFIX_EXPRESSION_HPP
 
 #include <queue.hpp>
+#include "compiled-expression.hpp"
 #include "token.hpp"
 
 namespace kizhin {
@@ -29,12 +30,15 @@ public:
   bool empty() const noexcept;
 
   number_type evaluate() const;
+  number_type evaluate(Buffer< number_type >& operands) const;
+  CompiledExpression compile() const;
 
   void clear() noexcept;
   void swap(PostfixExpression&) noexcept;
 
 private:
   Queue< Token > tokens_;
+  CompiledExpression compiled_;
 
   void appendExpression(const PostfixExpression&, const BinaryOperation*);
 };
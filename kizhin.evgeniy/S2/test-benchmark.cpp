@@ -0,0 +1,143 @@
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <boost/test/unit_test.hpp>
+#include <queue.hpp>
+#include "expression-reader.hpp"
+#include "io-utils.hpp"
+
+namespace {
+  using Clock = std::chrono::steady_clock;
+
+  template < typename F >
+  double measureNs(std::size_t iterations, F&& function)
+  {
+    const auto start = Clock::now();
+    for (std::size_t i = 0; i != iterations; ++i) {
+      function(i);
+    }
+    const std::chrono::duration< double, std::nano > elapsed = Clock::now() - start;
+    return elapsed.count() / iterations;
+  }
+
+  std::string generateInfix(std::size_t operands)
+  {
+    const char operations[] = { '+', '-', '*', '%' };
+    std::string result = "1";
+    for (std::size_t i = 1; i != operands; ++i) {
+      result += ' ';
+      result += operations[i % sizeof(operations)];
+      result += " ( " + std::to_string(i % 7 + 2) + " )";
+    }
+    return result;
+  }
+
+  std::size_t readWithStreams(const std::string& text)
+  {
+    std::istringstream in(text);
+    std::string line;
+    std::size_t tokens = 0;
+    while (std::getline(in, line)) {
+      if (!line.empty()) {
+        std::stringstream stream(line);
+        tokens += kizhin::inputPostfixExpression(stream).size();
+      }
+    }
+    return tokens;
+  }
+
+  std::size_t readWithReader(const std::string& text)
+  {
+    std::istringstream in(text);
+    kizhin::ExpressionReader reader(in);
+    kizhin::PostfixExpression current(kizhin::Queue< kizhin::Token >{});
+    std::size_t tokens = 0;
+    while (reader.next(current)) {
+      tokens += current.size();
+    }
+    return tokens;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(benchmark, *boost::unit_test::disabled());
+
+BOOST_AUTO_TEST_CASE(expression_evaluation)
+{
+  constexpr std::size_t evaluations = 10000;
+  std::cout << "operands\tpostfix ns/eval\tcompiled ns/eval\n";
+  for (std::size_t operands = 4; operands <= 1024; operands *= 4) {
+    std::istringstream in(generateInfix(operands));
+    const kizhin::PostfixExpression expression = kizhin::inputPostfixExpression(in);
+    const kizhin::CompiledExpression compiled = expression.compile();
+    long long checksum = 0;
+    const auto postfix = [&](std::size_t)
+    {
+      checksum += expression.evaluate();
+    };
+    const auto bytecode = [&](std::size_t)
+    {
+      checksum -= compiled.evaluate();
+    };
+    const double postfixNs = measureNs(evaluations, postfix);
+    const double compiledNs = measureNs(evaluations, bytecode);
+    std::cout << operands << '\t' << postfixNs << '\t' << compiledNs << '\n';
+    BOOST_TEST(checksum == 0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(expression_reading)
+{
+  constexpr double megabyte = 1024 * 1024;
+  std::cout << "operands\tstreams MB/s\treader MB/s\n";
+  for (std::size_t operands = 4; operands <= 1024; operands *= 16) {
+    const std::string line = generateInfix(operands) + '\n';
+    std::string text;
+    while (text.size() < 16 * megabyte) {
+      text += line;
+    }
+    std::size_t streamTokens = 0;
+    std::size_t readerTokens = 0;
+    const auto streams = [&](std::size_t)
+    {
+      streamTokens += readWithStreams(text);
+    };
+    const auto reader = [&](std::size_t)
+    {
+      readerTokens += readWithReader(text);
+    };
+    const double streamsMbs = text.size() / megabyte / (measureNs(1, streams) * 1e-9);
+    const double readerMbs = text.size() / megabyte / (measureNs(1, reader) * 1e-9);
+    std::cout << operands << '\t' << streamsMbs << '\t' << readerMbs << '\n';
+    BOOST_TEST(streamTokens == readerTokens);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(queue_throughput)
+{
+  std::cout << "elements\tqueue ns/op\n";
+  for (std::size_t elements = 1000; elements <= 10000000; elements *= 10) {
+    long long checksum = 0;
+    const auto cycle = [&](std::size_t)
+    {
+      kizhin::Queue< long long > queue;
+      for (std::size_t i = 0; i != elements; ++i) {
+        queue.push(i);
+      }
+      for (std::size_t i = 0; i != elements; ++i) {
+        checksum += queue.front();
+        queue.pop();
+        queue.push(i);
+      }
+      for (; !queue.empty(); queue.pop()) {
+        checksum -= queue.front();
+      }
+    };
+    const double queueNs = measureNs(1, cycle) / (4.0 * elements);
+    std::cout << elements << '\t' << queueNs << '\n';
+    BOOST_TEST(checksum == 0);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END();
+
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <deque>
+#include <iterator>
 #include <boost/test/unit_test_suite.hpp>
 #include "test-utils.hpp"
 
@@ -219,6 +222,58 @@ BOOST_AUTO_TEST_CASE(pop_front)
   BOOST_TEST(buffer == expected);
 }
 
+BOOST_AUTO_TEST_CASE(push_pop_both_ends)
+{
+  BufferT buffer;
+  std::deque< BufferT::value_type > expected;
+  for (int i = 0; i != 1000; ++i) {
+    if (i % 3 == 0) {
+      buffer.pushFront(i);
+      expected.push_front(i);
+    } else {
+      buffer.pushBack(i);
+      expected.push_back(i);
+    }
+    if (i % 4 == 0) {
+      buffer.popFront();
+      expected.pop_front();
+    } else if (i % 7 == 0) {
+      buffer.popBack();
+      expected.pop_back();
+    }
+  }
+  testBufferInvariants(buffer);
+  BOOST_TEST(buffer.size() == expected.size());
+  BOOST_TEST(std::equal(buffer.begin(), buffer.end(), expected.begin()));
+}
+
+BOOST_AUTO_TEST_CASE(queue_pattern_reuses_storage)
+{
+  BufferT buffer;
+  for (int i = 0; i != 8; ++i) {
+    buffer.pushBack(i);
+  }
+  const BufferT::size_type capacity = buffer.capacity();
+  for (int i = 8; i != 1000; ++i) {
+    buffer.popFront();
+    buffer.pushBack(i);
+  }
+  const BufferT expected{ 992, 993, 994, 995, 996, 997, 998, 999 };
+  testBufferInvariants(buffer);
+  BOOST_TEST(buffer == expected);
+  BOOST_TEST(buffer.capacity() <= 2 * capacity);
+}
+
+BOOST_AUTO_TEST_CASE(push_own_element)
+{
+  BufferT buffer{ 1, 2, 3, 4 };
+  const BufferT expected{ 1, 1, 2, 3, 4, 4 };
+  buffer.pushBack(buffer.back());
+  buffer.pushFront(buffer.front());
+  testBufferInvariants(buffer);
+  BOOST_TEST(buffer == expected);
+}
+
 BOOST_AUTO_TEST_CASE(empty_fill_assign)
 {
   BufferT buffer;
@@ -292,6 +347,16 @@ BOOST_AUTO_TEST_CASE(swap)
   BOOST_TEST(second == firstCopy);
 }
 
+BOOST_AUTO_TEST_CASE(back_inserter)
+{
+  const int values[] = { 1, 2, 3, 4 };
+  BufferT buffer{ 0 };
+  std::copy(std::begin(values), std::end(values), kizhin::backInserter(buffer));
+  const BufferT expected{ 0, 1, 2, 3, 4 };
+  testBufferInvariants(buffer);
+  BOOST_TEST(buffer == expected);
+}
+
 BOOST_AUTO_TEST_SUITE_END();
 BOOST_AUTO_TEST_SUITE(comparison_operators);
 
@@ -0,0 +1,79 @@
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <boost/test/unit_test.hpp>
+#include "io-utils.hpp"
+
+namespace {
+  kizhin::PostfixExpression parse(const std::string& infix)
+  {
+    std::istringstream in(infix);
+    return kizhin::inputPostfixExpression(in);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(compiled_expression);
+
+BOOST_AUTO_TEST_CASE(single_number)
+{
+  const kizhin::CompiledExpression compiled = parse("42").compile();
+  BOOST_TEST(compiled.size() == 1);
+  BOOST_TEST(compiled.stackDepth() == 1);
+  BOOST_TEST(compiled.evaluate() == 42);
+}
+
+BOOST_AUTO_TEST_CASE(all_operations)
+{
+  const kizhin::CompiledExpression compiled = parse("( 7 + 5 ) * 3 - 20 / 4 % 3").compile();
+  BOOST_TEST(compiled.evaluate() == 34);
+  BOOST_TEST(compiled.evaluate() == 34);
+}
+
+BOOST_AUTO_TEST_CASE(stack_depth)
+{
+  BOOST_TEST(parse("1 + 2 + 3 + 4").compile().stackDepth() == 2);
+  BOOST_TEST(parse("1 + ( 2 + ( 3 + 4 ) )").compile().stackDepth() == 4);
+}
+
+BOOST_AUTO_TEST_CASE(floored_modulus)
+{
+  const kizhin::PostfixExpression expression = parse("( 9 - 12 ) % 5 * ( 8 / 3 )");
+  BOOST_TEST(expression.compile().evaluate() == 4);
+  BOOST_TEST(expression.evaluate() == 4);
+  BOOST_TEST(parse("7 % ( 0 - 3 )").evaluate() == -2);
+}
+
+BOOST_AUTO_TEST_CASE(shared_operands)
+{
+  kizhin::Buffer< kizhin::CompiledExpression::number_type > operands;
+  const kizhin::CompiledExpression shallow = parse("2 * 3").compile();
+  const kizhin::CompiledExpression deep = parse("1 + ( 2 + ( 3 + 4 ) )").compile();
+  BOOST_TEST(shallow.evaluate(operands) == 6);
+  BOOST_TEST(deep.evaluate(operands) == 10);
+  BOOST_TEST(operands.size() == 4);
+  BOOST_TEST(shallow.evaluate(operands) == 6);
+}
+
+BOOST_AUTO_TEST_CASE(overflow)
+{
+  const std::string max = std::to_string(std::numeric_limits< long long >::max());
+  const kizhin::CompiledExpression compiled = parse(max + " + 1").compile();
+  BOOST_CHECK_THROW(compiled.evaluate(), std::overflow_error);
+}
+
+BOOST_AUTO_TEST_CASE(division_by_zero)
+{
+  const kizhin::CompiledExpression compiled = parse("1 / ( 2 - 2 )").compile();
+  BOOST_CHECK_THROW(compiled.evaluate(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(invalid_expression)
+{
+  BOOST_CHECK_THROW(parse("").compile(), std::logic_error);
+  BOOST_CHECK_THROW(parse("1 2").compile(), std::logic_error);
+  BOOST_CHECK_THROW(parse("+ 1").compile(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
+
@@ -0,0 +1,74 @@
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <boost/test/unit_test.hpp>
+#include "expression-reader.hpp"
+#include "io-utils.hpp"
+
+namespace {
+  using number_type = kizhin::PostfixExpression::number_type;
+
+  std::vector< number_type > readAll(const std::string& text, std::size_t chunkSize)
+  {
+    std::istringstream in(text);
+    kizhin::ExpressionReader reader(in, chunkSize);
+    kizhin::PostfixExpression current(kizhin::Queue< kizhin::Token >{});
+    std::vector< number_type > result;
+    while (reader.next(current)) {
+      result.push_back(current.evaluate());
+    }
+    return result;
+  }
+
+  number_type evaluateLine(const std::string& line)
+  {
+    std::istringstream in(line);
+    return kizhin::inputPostfixExpression(in).evaluate();
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(expression_reader);
+
+BOOST_AUTO_TEST_CASE(empty_input)
+{
+  BOOST_TEST(readAll("", 4).empty());
+  BOOST_TEST(readAll("\n\n\n", 4).empty());
+}
+
+BOOST_AUTO_TEST_CASE(lines_across_chunks)
+{
+  const std::string text = "1 + 2\n\n( 3 * 4 ) % 5\n10 - 20 / 3";
+  const std::vector< number_type > expected{ 3, 2, 4 };
+  for (std::size_t chunkSize = 1; chunkSize != 16; ++chunkSize) {
+    BOOST_TEST(readAll(text, chunkSize) == expected);
+  }
+  BOOST_TEST(readAll(text + '\n', 1024) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(matches_stream_parser)
+{
+  const std::string lines[] = {
+    "( -3 ) * 2 + 7",
+    "(\t-9223372036854775808 ) % 10",
+    "9223372036854775807 - 1",
+    "100/7*7 + 100 % 7",
+    "(((1)))+2\r",
+  };
+  for (const std::string& line: lines) {
+    const std::vector< number_type > expected{ evaluateLine(line) };
+    BOOST_TEST(readAll(line, 3) == expected);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(stops_at_invalid_token)
+{
+  BOOST_TEST(readAll("7 x + 1", 64) == std::vector< number_type >{ 7 });
+  BOOST_CHECK_THROW(readAll("1 + x", 64), std::logic_error);
+  BOOST_CHECK_THROW(readAll("( - 1 )", 64), std::logic_error);
+  BOOST_CHECK_THROW(readAll("9223372036854775808", 64), std::logic_error);
+  BOOST_CHECK_THROW(readAll("   ", 64), std::logic_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
+
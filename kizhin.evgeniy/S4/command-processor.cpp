@@ -1,9 +1,11 @@
 #include "command-processor.hpp"
+#include <algorithm>
 #include <functional>
 #include <iostream>
 #include <limits>
 #include <map>
 #include <stdexcept>
+#include <buffer.hpp>
 #include "io-utils.hpp"
 
 namespace kizhin {
@@ -11,6 +13,9 @@ namespace kizhin {
   void complement(DSContainer&, std::istream&);
   void intersect(DSContainer&, std::istream&);
   void unionCmd(DSContainer&, std::istream&);
+
+  using DatasetBuffer = Buffer< std::pair< Dataset::key_type, Dataset::mapped_type > >;
+  Dataset makeDataset(DatasetBuffer&);
 }
 
 void kizhin::processCommands(DSContainer& datasets, std::istream& in, std::ostream& out)
@@ -62,13 +67,11 @@ void kizhin::complement(DSContainer& datasets, std::istream& in)
   }
   const auto& ds1 = datasets.at(name1);
   const auto& ds2 = datasets.at(name2);
-  Dataset result;
-  for (const auto& p: ds1) {
-    if (!ds2.count(p.first)) {
-      result[p.first] = p.second;
-    }
-  }
-  datasets[newName] = result;
+  DatasetBuffer result;
+  const auto comp = ds1.valueComp();
+  const auto out = backInserter(result);
+  std::set_difference(ds1.begin(), ds1.end(), ds2.begin(), ds2.end(), out, comp);
+  datasets[newName] = makeDataset(result);
 }
 
 void kizhin::intersect(DSContainer& datasets, std::istream& in)
@@ -81,18 +84,15 @@ void kizhin::intersect(DSContainer& datasets, std::istream& in)
   }
   const auto& ds1 = datasets.at(name1);
   const auto& ds2 = datasets.at(name2);
-  Dataset result;
-  for (const auto& p: ds1) {
-    if (ds2.count(p.first)) {
-      result[p.first] = p.second;
-    }
-  }
-  datasets[newName] = result;
+  DatasetBuffer result;
+  const auto comp = ds1.valueComp();
+  const auto out = backInserter(result);
+  std::set_intersection(ds1.begin(), ds1.end(), ds2.begin(), ds2.end(), out, comp);
+  datasets[newName] = makeDataset(result);
 }
 
 void kizhin::unionCmd(DSContainer& datasets, std::istream& in)
 {
-
   DSContainer::key_type newName;
   DSContainer::key_type name1;
   DSContainer::key_type name2;
@@ -101,12 +101,17 @@ void kizhin::unionCmd(DSContainer& datasets, std::istream& in)
   }
   const auto& ds1 = datasets.at(name1);
   const auto& ds2 = datasets.at(name2);
-  Dataset result = ds1;
-  for (const auto& p: ds2) {
-    if (!result.count(p.first)) {
-      result[p.first] = p.second;
-    }
-  }
-  datasets[newName] = result;
+  DatasetBuffer result;
+  const auto comp = ds1.valueComp();
+  const auto out = backInserter(result);
+  std::set_union(ds1.begin(), ds1.end(), ds2.begin(), ds2.end(), out, comp);
+  datasets[newName] = makeDataset(result);
+}
+
+kizhin::Dataset kizhin::makeDataset(DatasetBuffer& values)
+{
+  const auto first = std::make_move_iterator(values.begin());
+  const auto last = std::make_move_iterator(values.end());
+  return Dataset(sortedUnique, first, last);
 }
 
@@ -1,5 +1,6 @@
 #include "io-utils.hpp"
 #include <iostream>
+#include <buffer.hpp>
 
 namespace kizhin {
   std::istream& operator>>(std::istream&, Dataset&);
@@ -24,7 +25,7 @@ std::istream& kizhin::operator>>(std::istream& in, DSContainer& dest)
   }
   if (!input.empty()) {
     in.clear();
-    dest = input;
+    dest = std::move(input);
   }
   return in;
 }
@@ -51,12 +52,12 @@ std::istream& kizhin::operator>>(std::istream& in, Dataset& dest)
   }
   Dataset::key_type key{};
   Dataset::mapped_type val{};
-  Dataset input;
+  Buffer< std::pair< Dataset::key_type, Dataset::mapped_type > > input;
   while (in >> key >> val) {
-    input.emplace(std::move(key), std::move(val));
+    input.emplaceBack(std::move(key), std::move(val));
   }
   in.clear();
-  dest = input;
+  dest = makeMap< Dataset >(input.begin(), input.end());
   return in;
 }
 
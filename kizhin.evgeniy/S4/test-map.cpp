@@ -1,5 +1,6 @@
 #include <numeric>
 #include <random>
+#include <vector>
 #include <boost/test/unit_test.hpp>
 #include "test-utils.hpp"
 
@@ -82,6 +83,63 @@ BOOST_AUTO_TEST_CASE(initializer_list_constructor)
   BOOST_TEST(map.size() == init.size());
   BOOST_TEST(std::equal(map.begin(), map.end(), init.begin()));
 }
+
+BOOST_AUTO_TEST_CASE(unsorted_range_constructor)
+{
+  const std::vector< MapT::value_type > values{
+    { 3, "ghi" },
+    { 1, "abc" },
+    { 3, "xyz" },
+    { 2, "def" },
+  };
+  const MapT map(values.begin(), values.end());
+  const MapT expected{ values[1], values[3], values[0] };
+  testMapInvariants(map);
+  BOOST_TEST(map == expected);
+}
+
+BOOST_AUTO_TEST_CASE(sorted_unique_constructor)
+{
+  for (int size = 0; size != 200; ++size) {
+    std::vector< MapT::value_type > values;
+    for (int i = 0; i != size; ++i) {
+      values.emplace_back(i * 2, std::to_string(i));
+    }
+    MapT map(kizhin::sortedUnique, values.begin(), values.end());
+    testMapInvariants(map);
+    BOOST_TEST(map.size() == values.size());
+    BOOST_TEST(std::equal(map.begin(), map.end(), values.begin()));
+    const auto reversed = std::make_reverse_iterator(map.end());
+    BOOST_TEST(std::equal(values.rbegin(), values.rend(), reversed));
+    for (int i = 0; i != size; ++i) {
+      BOOST_TEST(map.at(i * 2) == std::to_string(i));
+      BOOST_TEST(map.count(i * 2 + 1) == 0);
+    }
+    for (int i = 0; i != size; ++i) {
+      map.emplace(i * 2 + 1, std::to_string(i));
+    }
+    for (int i = 0; i < size; i += 2) {
+      map.erase(i * 2);
+    }
+    testMapInvariants(map);
+    BOOST_TEST(map.size() == static_cast< std::size_t >(size + size / 2));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(make_map)
+{
+  std::vector< std::pair< int, std::string > > values{
+    { 5, "e" },
+    { 1, "a" },
+    { 5, "x" },
+    { 3, "c" },
+    { 1, "y" },
+  };
+  const MapT map = kizhin::makeMap< MapT >(values.begin(), values.end());
+  const MapT expected{ { 1, "a" }, { 3, "c" }, { 5, "e" } };
+  testMapInvariants(map);
+  BOOST_TEST(map == expected);
+}
 BOOST_AUTO_TEST_SUITE_END();
 BOOST_AUTO_TEST_SUITE(assignment_operators);
 
@@ -1,6 +1,7 @@
 #include "map-utils.hpp"
 #include <istream>
 #include <limits>
+#include <buffer.hpp>
 
 std::istream& kizhin::operator>>(std::istream& in, MapT& dest)
 {
@@ -10,13 +11,12 @@ std::istream& kizhin::operator>>(std::istream& in, MapT& dest)
   }
   MapT::key_type key{};
   MapT::mapped_type val{};
-  MapT input;
+  Buffer< std::pair< MapT::key_type, MapT::mapped_type > > input;
   while (in >> key >> val) {
-    input.emplace(std::move(key), std::move(val));
+    input.emplaceBack(std::move(key), std::move(val));
   }
   in.clear();
-  dest = input;
-  return in;
+  dest = makeMap< MapT >(input.begin(), input.end());
   return in;
 }
 
@@ -134,7 +134,7 @@ void kizhin::bindEdge(GraphContainer& graphs, std::istream& in)
     throw std::logic_error("Falied to input key");
   }
   Graph& target = graphs.at(graphName);
-  target[{ from, to }].insert(weight);
+  target[{ std::move(from), std::move(to) }].insert(weight);
 }
 
 void kizhin::cutEdge(GraphContainer& graphs, std::istream& in)
@@ -147,7 +147,7 @@ void kizhin::cutEdge(GraphContainer& graphs, std::istream& in)
     throw std::logic_error("Falied to input key");
   }
   Graph& graph = graphs.at(graphName);
-  auto edgePos = graph.find({ from, to });
+  auto edgePos = graph.find(VertexPairView{ from, to });
   if (edgePos == graph.end()) {
     throw std::logic_error("Failed to find edge");
   }
@@ -203,7 +203,6 @@ void kizhin::merge(GraphContainer& graphs, std::istream& in)
     const WeightContiner& weights = edge.second;
     result[vertexes].insert(weights.begin(), weights.end());
   }
-  result.insert(graphs[secondSrc].begin(), graphs[secondSrc].end());
   graphs[dest] = std::move(result);
 }
 
@@ -1,33 +1,14 @@
 #include "graph.hpp"
-#include <algorithm>
 #include <tuple>
 #include <boost/hash2/fnv1a.hpp>
 #include <boost/hash2/hash_append.hpp>
 
-namespace kizhin {
-  struct VertexEdgeFrom
-  {
-    Vertex lhs{};
-    bool operator()(Graph::const_reference rhs) const
-    {
-      const VertexPair& vertexes = rhs.first;
-      return lhs == vertexes.from;
-    }
-  };
-
-  struct VertexEdgeTo
-  {
-    Vertex lhs{};
-    bool operator()(Graph::const_reference rhs) const
-    {
-      const VertexPair& vertexes = rhs.first;
-      return lhs == vertexes.to;
-    }
-  };
+std::size_t kizhin::VertexPairHash::operator()(const VertexPair& value) const
+{
+  return operator()(VertexPairView{ value.from, value.to });
 }
 
-std::size_t std::hash< kizhin::VertexPair >::operator()(
-    const kizhin::VertexPair& value) const
+std::size_t kizhin::VertexPairHash::operator()(const VertexPairView& value) const
 {
   namespace hash2 = boost::hash2;
   hash2::fnv1a_64 hasher;
@@ -36,6 +17,18 @@ std::size_t std::hash< kizhin::VertexPair >::operator()(
   return hash2::get_integral_result< size_t >(hasher);
 }
 
+bool kizhin::VertexPairEqual::operator()(const VertexPair& lhs,
+    const VertexPair& rhs) const
+{
+  return lhs == rhs;
+}
+
+bool kizhin::VertexPairEqual::operator()(const VertexPair& lhs,
+    const VertexPairView& rhs) const
+{
+  return lhs.from == rhs.from && lhs.to == rhs.to;
+}
+
 bool kizhin::operator==(const VertexPair& lhs, const VertexPair& rhs)
 {
   return lhs.from == rhs.from && lhs.to == rhs.to;
@@ -48,30 +41,188 @@ bool kizhin::operator<(const VertexPair& lhs, const VertexPair& rhs)
   return lhsTuple < rhsTuple;
 }
 
-kizhin::VertexContainer kizhin::getVertices(const Graph& graph)
+bool kizhin::Graph::empty() const noexcept
+{
+  return edges_.empty();
+}
+
+kizhin::Graph::size_type kizhin::Graph::size() const noexcept
+{
+  return edges_.size();
+}
+
+kizhin::Graph::iterator kizhin::Graph::begin() noexcept
+{
+  return edges_.begin();
+}
+
+kizhin::Graph::iterator kizhin::Graph::end() noexcept
+{
+  return edges_.end();
+}
+
+kizhin::Graph::const_iterator kizhin::Graph::begin() const noexcept
+{
+  return edges_.begin();
+}
+
+kizhin::Graph::const_iterator kizhin::Graph::end() const noexcept
+{
+  return edges_.end();
+}
+
+kizhin::Graph::mapped_type& kizhin::Graph::operator[](const key_type& key)
+{
+  return bindInserted(edges_.try_emplace(key));
+}
+
+kizhin::Graph::mapped_type& kizhin::Graph::operator[](key_type&& key)
+{
+  return bindInserted(edges_.try_emplace(std::move(key)));
+}
+
+kizhin::Graph::iterator kizhin::Graph::find(const key_type& key)
+{
+  return edges_.find(key);
+}
+
+kizhin::Graph::iterator kizhin::Graph::find(const VertexPairView& key)
+{
+  return edges_.find(key);
+}
+
+kizhin::Graph::const_iterator kizhin::Graph::find(const key_type& key) const
+{
+  return edges_.find(key);
+}
+
+kizhin::Graph::const_iterator kizhin::Graph::find(const VertexPairView& key) const
+{
+  return edges_.find(key);
+}
+
+kizhin::Graph::size_type kizhin::Graph::count(const key_type& key) const
+{
+  return edges_.count(key);
+}
+
+std::pair< kizhin::Graph::iterator, bool > kizhin::Graph::insert(const value_type& value)
+{
+  auto result = edges_.insert(value);
+  bindInserted(result);
+  return result;
+}
+
+kizhin::Graph::iterator kizhin::Graph::erase(const_iterator position)
+{
+  unbindVertices(position->first);
+  return edges_.erase(position);
+}
+
+const kizhin::Graph::NeighbourContainer& kizhin::Graph::outbound(
+    const Vertex& vertex) const
+{
+  static const NeighbourContainer noNeighbours{};
+  auto pos = outbound_.find(vertex);
+  return pos == outbound_.end() ? noNeighbours : pos->second;
+}
+
+const kizhin::Graph::NeighbourContainer& kizhin::Graph::inbound(
+    const Vertex& vertex) const
+{
+  static const NeighbourContainer noNeighbours{};
+  auto pos = inbound_.find(vertex);
+  return pos == inbound_.end() ? noNeighbours : pos->second;
+}
+
+kizhin::VertexContainer kizhin::Graph::vertices() const
 {
   VertexContainer result;
-  for (const auto& edge: graph) {
-    const VertexPair& vertexes = edge.first;
-    result.insert(vertexes.from);
-    result.insert(vertexes.to);
+  for (const auto& adjacency: outbound_) {
+    result.insert(adjacency.first);
+  }
+  for (const auto& adjacency: inbound_) {
+    result.insert(adjacency.first);
   }
   return result;
 }
 
+void kizhin::Graph::clear() noexcept
+{
+  edges_.clear();
+  outbound_.clear();
+  inbound_.clear();
+}
+
+void kizhin::Graph::swap(Graph& rhs) noexcept
+{
+  edges_.swap(rhs.edges_);
+  outbound_.swap(rhs.outbound_);
+  inbound_.swap(rhs.inbound_);
+}
+
+kizhin::Graph::mapped_type& kizhin::Graph::bindInserted(
+    std::pair< iterator, bool > inserted)
+{
+  if (inserted.second) {
+    try {
+      bindVertices(inserted.first->first);
+    } catch (...) {
+      edges_.erase(inserted.first);
+      throw;
+    }
+  }
+  return inserted.first->second;
+}
+
+void kizhin::Graph::bindVertices(const key_type& key)
+{
+  NeighbourContainer& outNeighbours = outbound_[key.from];
+  outNeighbours.insert(key.to);
+  try {
+    inbound_[key.to].insert(key.from);
+  } catch (...) {
+    outNeighbours.erase(key.to);
+    throw;
+  }
+}
+
+void kizhin::Graph::unbindVertices(const key_type& key)
+{
+  auto outPos = outbound_.find(key.from);
+  outPos->second.erase(key.to);
+  if (outPos->second.empty()) {
+    outbound_.erase(outPos);
+  }
+  auto inPos = inbound_.find(key.to);
+  inPos->second.erase(key.from);
+  if (inPos->second.empty()) {
+    inbound_.erase(inPos);
+  }
+}
+
+kizhin::VertexContainer kizhin::getVertices(const Graph& graph)
+{
+  return graph.vertices();
+}
+
 kizhin::SortedGraph kizhin::getOutbound(const Graph& graph, const Vertex& vertex)
 {
   SortedGraph result;
-  auto out = std::inserter(result, result.end());
-  std::copy_if(graph.begin(), graph.end(), out, VertexEdgeFrom{ vertex });
+  for (const Vertex& to: graph.outbound(vertex)) {
+    const auto edge = graph.find(VertexPairView{ vertex, to });
+    result.emplace_hint(result.end(), edge->first, edge->second);
+  }
   return result;
 }
 
 kizhin::SortedGraph kizhin::getInbound(const Graph& graph, const Vertex& vertex)
 {
   SortedGraph result;
-  auto out = std::inserter(result, result.end());
-  std::copy_if(graph.begin(), graph.end(), out, VertexEdgeTo{ vertex });
+  for (const Vertex& from: graph.inbound(vertex)) {
+    const auto edge = graph.find(VertexPairView{ from, vertex });
+    result.emplace_hint(result.end(), edge->first, edge->second);
+  }
   return result;
 }
 
@@ -13,25 +13,90 @@ namespace kizhin {
     Vertex from{};
     Vertex to{};
   };
-}
 
-namespace std {
-  template <>
-  struct hash< kizhin::VertexPair >
+  struct VertexPairView
   {
-    size_t operator()(const kizhin::VertexPair&) const;
+    const Vertex& from;
+    const Vertex& to;
+  };
+
+  struct VertexPairHash
+  {
+    using is_transparent = void;
+    std::size_t operator()(const VertexPair&) const;
+    std::size_t operator()(const VertexPairView&) const;
+  };
+
+  struct VertexPairEqual
+  {
+    using is_transparent = void;
+    bool operator()(const VertexPair&, const VertexPair&) const;
+    bool operator()(const VertexPair&, const VertexPairView&) const;
   };
-}
 
-namespace kizhin {
   using Weight = std::size_t;
   using WeightContiner = std::multiset< Weight >;
 
   bool operator==(const VertexPair&, const VertexPair&);
   bool operator<(const VertexPair&, const VertexPair&);
 
-  using Graph = UnorderedMap< VertexPair, WeightContiner >;
+  class Graph;
   using VertexContainer = std::set< Vertex >;
+}
+
+class kizhin::Graph final
+{
+public:
+  using EdgeContainer =
+      UnorderedMap< VertexPair, WeightContiner, VertexPairHash, VertexPairEqual >;
+  using key_type = EdgeContainer::key_type;
+  using mapped_type = EdgeContainer::mapped_type;
+  using value_type = EdgeContainer::value_type;
+  using size_type = EdgeContainer::size_type;
+  using iterator = EdgeContainer::iterator;
+  using const_iterator = EdgeContainer::const_iterator;
+  using NeighbourContainer = std::set< Vertex >;
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+
+  iterator begin() noexcept;
+  iterator end() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+
+  mapped_type& operator[](const key_type&);
+  mapped_type& operator[](key_type&&);
+
+  iterator find(const key_type&);
+  iterator find(const VertexPairView&);
+  const_iterator find(const key_type&) const;
+  const_iterator find(const VertexPairView&) const;
+  size_type count(const key_type&) const;
+
+  std::pair< iterator, bool > insert(const value_type&);
+  iterator erase(const_iterator);
+
+  const NeighbourContainer& outbound(const Vertex&) const;
+  const NeighbourContainer& inbound(const Vertex&) const;
+  VertexContainer vertices() const;
+
+  void clear() noexcept;
+  void swap(Graph&) noexcept;
+
+private:
+  using AdjacencyContainer = UnorderedMap< Vertex, NeighbourContainer >;
+
+  EdgeContainer edges_;
+  AdjacencyContainer outbound_;
+  AdjacencyContainer inbound_;
+
+  mapped_type& bindInserted(std::pair< iterator, bool >);
+  void bindVertices(const key_type&);
+  void unbindVertices(const key_type&);
+};
+
+namespace kizhin {
   using SortedGraph = std::map< Graph::key_type, Graph::mapped_type >;
 
   VertexContainer getVertices(const Graph&);
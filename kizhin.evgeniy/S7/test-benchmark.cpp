@@ -0,0 +1,63 @@
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <boost/test/unit_test.hpp>
+#include "graph.hpp"
+
+namespace {
+  using Clock = std::chrono::steady_clock;
+
+  template < typename F >
+  double measureNs(std::size_t iterations, F&& function)
+  {
+    const auto start = Clock::now();
+    for (std::size_t i = 0; i != iterations; ++i) {
+      function(i);
+    }
+    const std::chrono::duration< double, std::nano > elapsed = Clock::now() - start;
+    return elapsed.count() / iterations;
+  }
+
+  kizhin::Graph generateGraph(std::size_t vertexCount, std::size_t edgeCount)
+  {
+    std::mt19937 engine(edgeCount);
+    std::uniform_int_distribution< std::size_t > vertex(0, vertexCount - 1);
+    kizhin::Graph graph;
+    while (graph.size() != edgeCount) {
+      std::string from = std::to_string(vertex(engine));
+      std::string to = std::to_string(vertex(engine));
+      graph[{ std::move(from), std::move(to) }].insert(edgeCount);
+    }
+    return graph;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(benchmark, *boost::unit_test::disabled());
+
+BOOST_AUTO_TEST_CASE(neighbour_queries)
+{
+  constexpr std::size_t averageDegree = 8;
+  constexpr std::size_t queries = 1000;
+  std::cout << "edges\toutbound ns/query\tinbound ns/query\n";
+  for (std::size_t edges = 1000; edges <= 1000000; edges *= 10) {
+    const std::size_t vertexCount = edges / averageDegree;
+    const kizhin::Graph graph = generateGraph(vertexCount, edges);
+    std::size_t checksum = 0;
+    const auto outbound = [&](std::size_t i)
+    {
+      checksum += kizhin::getOutbound(graph, std::to_string(i % vertexCount)).size();
+    };
+    const auto inbound = [&](std::size_t i)
+    {
+      checksum += kizhin::getInbound(graph, std::to_string(i % vertexCount)).size();
+    };
+    const double outboundNs = measureNs(queries, outbound);
+    const double inboundNs = measureNs(queries, inbound);
+    std::cout << edges << '\t' << outboundNs << '\t' << inboundNs << '\n';
+    BOOST_TEST(checksum != 0);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END();
+
@@ -0,0 +1,76 @@
+#include <boost/test/unit_test.hpp>
+#include "graph.hpp"
+
+using kizhin::Graph;
+using kizhin::VertexPair;
+
+BOOST_AUTO_TEST_SUITE(graph_adjacency);
+
+BOOST_AUTO_TEST_CASE(bind_updates_neighbours)
+{
+  Graph graph;
+  graph[{ "a", "b" }].insert(1);
+  graph[{ "a", "c" }].insert(2);
+  graph[{ "c", "a" }].insert(3);
+  const Graph::NeighbourContainer expectedOut = { "b", "c" };
+  const Graph::NeighbourContainer expectedIn = { "c" };
+  BOOST_TEST(graph.outbound("a") == expectedOut);
+  BOOST_TEST(graph.inbound("a") == expectedIn);
+  BOOST_TEST(graph.outbound("b").empty());
+}
+
+BOOST_AUTO_TEST_CASE(erase_updates_neighbours)
+{
+  Graph graph;
+  graph[{ "a", "b" }].insert(1);
+  graph[{ "a", "c" }].insert(2);
+  graph.erase(graph.find(VertexPair{ "a", "b" }));
+  const Graph::NeighbourContainer expectedOut = { "c" };
+  BOOST_TEST(graph.outbound("a") == expectedOut);
+  BOOST_TEST(graph.inbound("b").empty());
+  const kizhin::VertexContainer expectedVertices = { "a", "c" };
+  BOOST_TEST(graph.vertices() == expectedVertices);
+}
+
+BOOST_AUTO_TEST_CASE(sorted_outbound_and_inbound)
+{
+  Graph graph;
+  graph[{ "a", "c" }].insert(2);
+  graph[{ "a", "b" }].insert(1);
+  graph[{ "a", "b" }].insert(4);
+  graph[{ "b", "c" }].insert(3);
+  const kizhin::SortedGraph outbound = kizhin::getOutbound(graph, "a");
+  BOOST_TEST(outbound.size() == 2);
+  BOOST_TEST(outbound.begin()->first.to == "b");
+  BOOST_TEST(outbound.begin()->second.size() == 2);
+  const kizhin::SortedGraph inbound = kizhin::getInbound(graph, "c");
+  BOOST_TEST(inbound.size() == 2);
+  BOOST_TEST(inbound.begin()->first.from == "a");
+  BOOST_TEST(kizhin::getOutbound(graph, "missing").empty());
+}
+
+BOOST_AUTO_TEST_CASE(find_by_view)
+{
+  Graph graph;
+  graph[{ "a", "b" }].insert(1);
+  const kizhin::Vertex from = "a";
+  const kizhin::Vertex to = "b";
+  auto edge = graph.find(kizhin::VertexPairView{ from, to });
+  BOOST_TEST((edge != graph.end()));
+  BOOST_TEST(edge->second.count(1) == 1);
+  BOOST_TEST((graph.find(kizhin::VertexPairView{ to, from }) == graph.end()));
+}
+
+BOOST_AUTO_TEST_CASE(copy_keeps_index)
+{
+  Graph graph;
+  graph[{ "a", "b" }].insert(1);
+  Graph copy(graph);
+  graph.erase(graph.find(VertexPair{ "a", "b" }));
+  BOOST_TEST(graph.outbound("a").empty());
+  BOOST_TEST(copy.outbound("a").size() == 1);
+  BOOST_TEST(copy.inbound("b").size() == 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
+
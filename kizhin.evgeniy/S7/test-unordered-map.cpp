@@ -1,9 +1,26 @@
+#include <string>
 #include <boost/test/unit_test.hpp>
 #include <boost/test/unit_test_suite.hpp>
 #include <unordered-map.hpp>
 
 using UnorderedMapT = kizhin::UnorderedMap< int, int >;
 
+struct TransparentStringHash
+{
+  using is_transparent = void;
+  std::size_t operator()(const std::string& value) const
+  {
+    return std::hash< std::string >{}(value);
+  }
+  std::size_t operator()(const char* value) const
+  {
+    return std::hash< std::string >{}(value);
+  }
+};
+
+using TransparentMapT =
+    kizhin::UnorderedMap< std::string, int, TransparentStringHash, std::equal_to<> >;
+
 void testUnorderedMapInvariants(const UnorderedMapT& map)
 {
   const std::size_t count = std::distance(map.begin(), map.end());
@@ -116,6 +133,15 @@ BOOST_AUTO_TEST_CASE(square_brackets_new_key)
   BOOST_TEST(map.find(1)->second == 1);
 }
 
+BOOST_AUTO_TEST_CASE(square_brackets_rvalue_key)
+{
+  kizhin::UnorderedMap< std::string, int > map;
+  std::string key = "key";
+  map[std::move(key)] = 1;
+  BOOST_TEST(map.size() == 1);
+  BOOST_TEST(map.at("key") == 1);
+}
+
 BOOST_AUTO_TEST_CASE(at_existing_key)
 {
   UnorderedMapT map = { { 1, 1 } };
@@ -175,6 +201,27 @@ BOOST_AUTO_TEST_CASE(insert_range)
   BOOST_TEST(map.at(2) == 2);
 }
 
+BOOST_AUTO_TEST_CASE(try_emplace_new_key)
+{
+  UnorderedMapT map;
+  const auto result = map.try_emplace(1, 2);
+  testUnorderedMapInvariants(map);
+  BOOST_TEST(result.second);
+  BOOST_TEST((*result.first == UnorderedMapT::value_type(1, 2)));
+}
+
+BOOST_AUTO_TEST_CASE(try_emplace_existing_key)
+{
+  kizhin::UnorderedMap< std::string, std::string > map = { { "key", "value" } };
+  std::string key = "key";
+  std::string value = "other";
+  const auto result = map.try_emplace(std::move(key), std::move(value));
+  BOOST_TEST(!result.second);
+  BOOST_TEST(result.first->second == "value");
+  BOOST_TEST(key == "key");
+  BOOST_TEST(value == "other");
+}
+
 BOOST_AUTO_TEST_CASE(erase_existing_key)
 {
   UnorderedMapT map = { { 1, 1 }, { 2, 2 } };
@@ -241,6 +288,22 @@ BOOST_AUTO_TEST_CASE(count_missing_key)
   testUnorderedMapInvariants(map);
 }
 
+BOOST_AUTO_TEST_CASE(transparent_find)
+{
+  const TransparentMapT map = { { "first", 1 }, { "second", 2 } };
+  auto it = map.find("second");
+  BOOST_TEST((it != map.end()));
+  BOOST_TEST(it->second == 2);
+  BOOST_TEST((map.find("third") == map.end()));
+}
+
+BOOST_AUTO_TEST_CASE(transparent_count)
+{
+  const TransparentMapT map = { { "first", 1 } };
+  BOOST_TEST(map.count("first") == 1);
+  BOOST_TEST(map.count("second") == 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END();
 
 BOOST_AUTO_TEST_SUITE(observers);
@@ -262,6 +325,74 @@ BOOST_AUTO_TEST_CASE(key_equal_function)
 
 BOOST_AUTO_TEST_SUITE_END();
 
+BOOST_AUTO_TEST_SUITE(hash_policy);
+
+BOOST_AUTO_TEST_CASE(erase_counts_tombstones)
+{
+  UnorderedMapT map;
+  for (int i = 0; i != 64; ++i) {
+    map[i] = i;
+  }
+  for (int i = 0; i != 64; i += 2) {
+    map.erase(i);
+  }
+  testUnorderedMapInvariants(map);
+  BOOST_TEST(map.size() == 32);
+  BOOST_TEST(map.tombstoneCount() <= 32);
+  BOOST_TEST(map.probeStatistics().tombstones == map.tombstoneCount());
+  BOOST_TEST((map.find(0) == map.end()));
+  BOOST_TEST(map.at(1) == 1);
+}
+
+BOOST_AUTO_TEST_CASE(tombstones_are_cleaned_up)
+{
+  UnorderedMapT map;
+  map.reserve(16);
+  const std::size_t buckets = map.bucketCount();
+  for (int i = 0; i != 10000; ++i) {
+    map[i] = i;
+    map[i + 1] = i;
+    map.erase(i);
+    map.erase(i + 1);
+  }
+  testUnorderedMapInvariants(map);
+  BOOST_TEST(map.empty());
+  BOOST_TEST(map.bucketCount() == buckets);
+  BOOST_TEST(map.tombstoneCount() < map.bucketCount());
+}
+
+BOOST_AUTO_TEST_CASE(rehash_drops_tombstones)
+{
+  UnorderedMapT map;
+  for (int i = 0; i != 64; ++i) {
+    map[i * 7] = i;
+  }
+  for (int i = 0; i < 64; i += 3) {
+    map.erase(i * 7);
+  }
+  const UnorderedMapT copy(map);
+  map.rehash(map.bucketCount());
+  testUnorderedMapInvariants(map);
+  BOOST_TEST(map.tombstoneCount() == 0);
+  BOOST_TEST(map == copy);
+}
+
+BOOST_AUTO_TEST_CASE(probe_statistics)
+{
+  UnorderedMapT map;
+  const auto emptyStats = map.probeStatistics();
+  BOOST_TEST(emptyStats.maxProbeLength == 0);
+  for (int i = 0; i != 100; ++i) {
+    map[i] = i;
+  }
+  const auto stats = map.probeStatistics();
+  BOOST_TEST(stats.maxProbeLength >= 1);
+  BOOST_TEST(stats.averageProbeLength >= 1.0f);
+  BOOST_TEST(stats.averageProbeLength <= stats.maxProbeLength);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
+
 BOOST_AUTO_TEST_SUITE(free_functions);
 
 BOOST_AUTO_TEST_CASE(equal_opeator)
@@ -3,6 +3,7 @@
 
 #include <functional>
 #include <iterator>
+#include <type_traits>
 #include <utility>
 
 namespace kizhin {
@@ -51,6 +52,17 @@ namespace kizhin {
     }
   }
 
+  template < typename InputIt, typename ResultIt >
+  ResultIt uninitializedMoveIfNoexcept(InputIt first, const InputIt last, ResultIt out)
+  {
+    using value_type = typename std::iterator_traits< InputIt >::value_type;
+    constexpr bool isMovable = std::is_nothrow_move_constructible< value_type >::value
+        || !std::is_copy_constructible< value_type >::value;
+    using MoveIt =
+        std::conditional_t< isMovable, std::move_iterator< InputIt >, InputIt >;
+    return uninitializedCopy(MoveIt(first), MoveIt(last), out);
+  }
+
   template < typename FwdIt, typename T >
   FwdIt uninitializedFill(FwdIt first, const FwdIt last, const T& value)
   {
@@ -3,8 +3,11 @@
 
 #include <cassert>
 #include <initializer_list>
+#include <iterator>
 #include <limits>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include "algorithm-utils.hpp"
 #include "type-utils.hpp"
@@ -70,6 +73,9 @@ namespace kizhin {
     void swap(Buffer&) noexcept;
 
   private:
+    static constexpr bool isRelocatable = std::is_nothrow_move_constructible< T >::value;
+
+    pointer first_;
     pointer begin_;
     pointer end_;
     pointer last_;
@@ -78,7 +84,10 @@ namespace kizhin {
 
     void allocate(size_type);
     void deallocate() noexcept;
-    void expand(size_type);
+    void expand(size_type, size_type);
+    void makeFrontRoom();
+    void makeBackRoom();
+    void relocate(pointer) noexcept;
     size_type growthCapacity(size_type) const;
 
     template < typename InputIt, enable_if_input_iterator< InputIt > = 0 >
@@ -90,6 +99,7 @@ namespace kizhin {
 
   template < typename T >
   Buffer< T >::Buffer() noexcept:
+    first_(nullptr),
     begin_(nullptr),
     end_(nullptr),
     last_(nullptr)
@@ -105,6 +115,7 @@ namespace kizhin {
 
   template < typename T >
   Buffer< T >::Buffer(Buffer&& rhs) noexcept:
+    first_(std::exchange(rhs.first_, nullptr)),
     begin_(std::exchange(rhs.begin_, nullptr)),
     end_(std::exchange(rhs.end_, nullptr)),
     last_(std::exchange(rhs.last_, nullptr))
@@ -212,7 +223,7 @@ namespace kizhin {
   template < typename T >
   typename Buffer< T >::size_type Buffer< T >::capacity() const noexcept
   {
-    return static_cast< size_type >(last_ - begin_);
+    return static_cast< size_type >(last_ - first_);
   }
 
   template < typename T >
@@ -259,17 +270,14 @@ namespace kizhin {
   template < typename... Args >
   void Buffer< T >::emplaceFront(Args&&... args)
   {
-    if (end_ == last_) {
-      expand(growthCapacity(capacity() + 1));
-    }
-    if (end_ != begin_) {
-      new (end_) value_type(std::move(*(end_ - 1)));
-      moveBackward(begin_, end_, end_ + 1);
-      *begin_ = value_type(std::forward< Args >(args)...);
+    if (begin_ == first_) {
+      value_type value(std::forward< Args >(args)...);
+      makeFrontRoom();
+      new (begin_ - 1) value_type(std::move(value));
     } else {
-      new (begin_) value_type(std::forward< Args >(args)...);
+      new (begin_ - 1) value_type(std::forward< Args >(args)...);
     }
-    ++end_;
+    --begin_;
   }
 
   template < typename T >
@@ -277,9 +285,12 @@ namespace kizhin {
   void Buffer< T >::emplaceBack(Args&&... args)
   {
     if (end_ == last_) {
-      expand(growthCapacity(capacity() + 1));
+      value_type value(std::forward< Args >(args)...);
+      makeBackRoom();
+      new (end_) value_type(std::move(value));
+    } else {
+      new (end_) value_type(std::forward< Args >(args)...);
     }
-    new (end_) value_type(std::forward< Args >(args)...);
     ++end_;
   }
 
@@ -331,6 +342,7 @@ namespace kizhin {
   void Buffer< T >::swap(Buffer& rhs) noexcept
   {
     using std::swap;
+    swap(first_, rhs.first_);
     swap(begin_, rhs.begin_);
     swap(end_, rhs.end_);
     swap(last_, rhs.last_);
@@ -346,30 +358,77 @@ namespace kizhin {
   void Buffer< T >::allocate(const size_type size)
   {
     assert(capacity() == 0 && "allocate() called in already allocated SplitBuffer");
-    begin_ = static_cast< pointer >(operator new(size * sizeof(T)));
-    end_ = begin_;
-    last_ = begin_ + size;
+    first_ = static_cast< pointer >(operator new(size * sizeof(T)));
+    begin_ = first_;
+    end_ = first_;
+    last_ = first_ + size;
   }
 
   template < typename T >
   void Buffer< T >::deallocate() noexcept
   {
-    operator delete(begin_);
+    operator delete(first_);
+    first_ = nullptr;
     begin_ = nullptr;
     end_ = nullptr;
     last_ = nullptr;
   }
 
   template < typename T >
-  void Buffer< T >::expand(const size_type newCapacity)
+  void Buffer< T >::expand(const size_type newCapacity, const size_type frontSpare)
   {
     assert(newCapacity > capacity() && "expandStorage(): less or equal capacity");
+    const bool assertion = frontSpare <= newCapacity - size();
+    assert(assertion && "expandStorage(): too large front spare");
     Buffer< T > newBuffer;
     newBuffer.allocate(newCapacity);
-    newBuffer.constructAtEnd(begin(), end());
+    newBuffer.begin_ += frontSpare;
+    newBuffer.end_ = uninitializedMoveIfNoexcept(begin_, end_, newBuffer.begin_);
     swap(newBuffer);
   }
 
+  template < typename T >
+  void Buffer< T >::makeFrontRoom()
+  {
+    const size_type backSpare = last_ - end_;
+    if (isRelocatable && backSpare != 0 && backSpare >= size()) {
+      relocate(begin_ + (backSpare + 1) / 2);
+      return;
+    }
+    const size_type newCapacity = growthCapacity(capacity() + 1);
+    expand(newCapacity, (newCapacity - size() + 1) / 2);
+  }
+
+  template < typename T >
+  void Buffer< T >::makeBackRoom()
+  {
+    const size_type frontSpare = begin_ - first_;
+    if (isRelocatable && frontSpare != 0 && frontSpare >= size()) {
+      relocate(first_);
+      return;
+    }
+    expand(growthCapacity(capacity() + 1), 0);
+  }
+
+  template < typename T >
+  void Buffer< T >::relocate(const pointer newBegin) noexcept
+  {
+    const size_type sz = size();
+    if (newBegin < begin_) {
+      for (size_type i = 0; i != sz; ++i) {
+        new (newBegin + i) value_type(std::move(begin_[i]));
+        begin_[i].~value_type();
+      }
+    } else {
+      for (size_type i = sz; i != 0; --i) {
+        new (newBegin + i - 1) value_type(std::move(begin_[i - 1]));
+        begin_[i - 1].~value_type();
+      }
+    }
+    begin_ = newBegin;
+    end_ = newBegin + sz;
+  }
+
   template < typename T >
   typename Buffer< T >::size_type Buffer< T >::growthCapacity(
       const size_type newCapacity) const
@@ -395,7 +454,8 @@ namespace kizhin {
   template < typename T >
   void Buffer< T >::constructAtEnd(const size_type sz, const_reference value)
   {
-    assert(sz <= capacity() - size() && "constructAtEnd(): insufficient back spare");
+    const bool assertion = sz <= static_cast< size_type >(last_ - end_);
+    assert(assertion && "constructAtEnd(): insufficient back spare");
     end_ = uninitializedFill(end_, end_ + sz, value);
   }
 
@@ -406,6 +466,10 @@ namespace kizhin {
     assert(assertion && "destroyAtEnd(): invalid newEnd");
     destroy(newEnd, end_);
     end_ = newEnd;
+    if (begin_ == end_) {
+      begin_ = first_;
+      end_ = first_;
+    }
   }
 
   template < typename T >
@@ -413,9 +477,11 @@ namespace kizhin {
   {
     const bool assertion = newBegin >= begin_ && newBegin <= end_;
     assert(assertion && "destroyAtBegin(): invalid newBegin");
-    pointer i = destroy(begin_, newBegin);
-    moveRange(i, end_, begin_);
-    end_ -= newBegin - begin_;
+    begin_ = destroy(begin_, newBegin);
+    if (begin_ == end_) {
+      begin_ = first_;
+      end_ = first_;
+    }
   }
 
   template < typename T >
@@ -459,6 +525,41 @@ namespace kizhin {
   {
     return !(lhs < rhs);
   }
+
+  template < typename T >
+  class BackInserter final
+  {
+  public:
+    using iterator_category = std::output_iterator_tag;
+    using value_type = void;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = void;
+
+    explicit BackInserter(Buffer< T >& buffer) noexcept:
+      buffer_(std::addressof(buffer))
+    {}
+
+    template < typename U >
+    BackInserter& operator=(U&& value)
+    {
+      buffer_->emplaceBack(std::forward< U >(value));
+      return *this;
+    }
+
+    BackInserter& operator*() noexcept { return *this; }
+    BackInserter& operator++() noexcept { return *this; }
+    BackInserter& operator++(int) noexcept { return *this; }
+
+  private:
+    Buffer< T >* buffer_;
+  };
+
+  template < typename T >
+  BackInserter< T > backInserter(Buffer< T >& buffer) noexcept
+  {
+    return BackInserter< T >(buffer);
+  }
 }
 
 #endif
@@ -2,6 +2,7 @@
 #define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_MAP_HPP
 
 #include <algorithm>
+#include <iterator>
 #include <memory>
 #include <tuple>
 #include <utility>
@@ -11,6 +12,10 @@
 #include "type-utils.hpp"
 
 namespace kizhin {
+  struct SortedUniqueTag
+  {};
+  constexpr SortedUniqueTag sortedUnique{};
+
   template < typename Key, typename T, typename Comparator = std::less< Key > >
   class Map final
   {
@@ -69,6 +74,8 @@ namespace kizhin {
     explicit Map(const key_compare&) noexcept(is_nothrow_copy_constructible);
     template < typename InputIt >
     Map(InputIt, InputIt, const key_compare& = key_compare{});
+    template < typename ForwardIt >
+    Map(SortedUniqueTag, ForwardIt, ForwardIt, const key_compare& = key_compare{});
     Map(std::initializer_list< value_type >, const key_compare& = key_compare{});
     ~Map();
 
@@ -152,6 +159,8 @@ namespace kizhin {
   private:
     using Node = detail::Node< value_type >;
     class EndNodeGuard;
+    struct SubtreeDeleter;
+    using SubtreePtr = std::unique_ptr< Node, SubtreeDeleter >;
 
     Node* root_ = nullptr;
     size_type size_ = 0;
@@ -160,6 +169,15 @@ namespace kizhin {
     void deallocate() noexcept;
     Node* getEndNode() const noexcept;
 
+    template < typename InputIt >
+    void construct(InputIt, InputIt, std::input_iterator_tag);
+    template < typename ForwardIt >
+    void construct(ForwardIt, ForwardIt, std::forward_iterator_tag);
+    template < typename ForwardIt >
+    void buildFromSorted(ForwardIt, size_type);
+    template < typename ForwardIt >
+    SubtreePtr buildSubtree(ForwardIt&, size_type, size_type);
+
     template < typename... Args >
     Node* emplaceToNode(Node*, Args&&...);
     template < typename... Args >
@@ -216,6 +234,9 @@ namespace kizhin {
 
   template < typename K, typename T, typename C >
   void swap(Map< K, T, C >& l, Map< K, T, C >& r) noexcept(noexcept(l.swap(r)));
+
+  template < typename MapT, typename RandomIt >
+  MapT makeMap(RandomIt, RandomIt, const typename MapT::key_compare& = {});
 }
 
 template < typename K, typename T, typename C >
@@ -652,7 +673,17 @@ kizhin::Map< K, T, C >::Map(const InputIt first, const InputIt last,
     const key_compare& comparator):
   Map(comparator)
 {
-  insert(first, last);
+  using category = typename std::iterator_traits< InputIt >::iterator_category;
+  construct(first, last, category{});
+}
+
+template < typename K, typename T, typename C >
+template < typename ForwardIt >
+kizhin::Map< K, T, C >::Map(SortedUniqueTag, const ForwardIt first, const ForwardIt last,
+    const key_compare& comparator):
+  Map(comparator)
+{
+  buildFromSorted(first, std::distance(first, last));
 }
 
 template < typename K, typename T, typename C >
@@ -1170,6 +1201,94 @@ typename kizhin::Map< K, T, C >::Node* kizhin::Map< K, T, C >::getEndNode() cons
   return detail::isEmpty(max) ? max : max->children[0];
 }
 
+template < typename K, typename T, typename C >
+struct kizhin::Map< K, T, C >::SubtreeDeleter
+{
+  void operator()(Node* node) const noexcept
+  {
+    for (Node* child: node->children) {
+      if (child) {
+        (*this)(child);
+      }
+    }
+    delete node;
+  }
+};
+
+template < typename K, typename T, typename C >
+template < typename InputIt >
+void kizhin::Map< K, T, C >::construct(InputIt first, const InputIt last,
+    std::input_iterator_tag)
+{
+  insert(first, last);
+}
+
+template < typename K, typename T, typename C >
+template < typename ForwardIt >
+void kizhin::Map< K, T, C >::construct(const ForwardIt first, const ForwardIt last,
+    std::forward_iterator_tag)
+{
+  auto notAscending = [this](const auto& lhs, const auto& rhs) -> bool
+  {
+    return !comparator_(lhs.first, rhs.first);
+  };
+  if (std::adjacent_find(first, last, notAscending) == last) {
+    buildFromSorted(first, std::distance(first, last));
+  } else {
+    insert(first, last);
+  }
+}
+
+template < typename K, typename T, typename C >
+template < typename ForwardIt >
+void kizhin::Map< K, T, C >::buildFromSorted(ForwardIt first, const size_type count)
+{
+  assert(empty() && "buildFromSorted: non-empty Map");
+  if (count == 0) {
+    return;
+  }
+  size_type maxSize = detail::maxValues - 1;
+  while (maxSize < count) {
+    maxSize = maxSize * detail::maxValues + detail::maxValues - 1;
+  }
+  SubtreePtr root = buildSubtree(first, count, maxSize);
+  Node* endNode = new Node;
+  root_ = root.release();
+  size_ = count;
+  Node* max = detail::treeMax(root_);
+  endNode->parent = max;
+  max->children.fill(endNode);
+}
+
+template < typename K, typename T, typename C >
+template < typename ForwardIt >
+typename kizhin::Map< K, T, C >::SubtreePtr kizhin::Map< K, T, C >::buildSubtree(
+    ForwardIt& current, const size_type count, const size_type maxSize)
+{
+  assert(count != 0 && count <= maxSize && "buildSubtree: invalid subtree size");
+  SubtreePtr node(new Node);
+  const size_type maxLeafSize = detail::maxValues - 1;
+  if (maxSize == maxLeafSize) {
+    for (size_type i = 0; i != count; ++i, ++current) {
+      detail::emplaceBack(node.get(), *current);
+    }
+    return node;
+  }
+  const size_type childMaxSize = (maxSize - maxLeafSize) / detail::maxValues;
+  const size_type childCount = count - 1 <= 2 * childMaxSize ? 2 : 3;
+  const size_type childrenSize = count - (childCount - 1);
+  for (size_type i = 0; i != childCount; ++i) {
+    const size_type childSize = childrenSize / childCount + (i < childrenSize % childCount);
+    node->children[i] = buildSubtree(current, childSize, childMaxSize).release();
+    node->children[i]->parent = node.get();
+    if (i + 1 != childCount) {
+      detail::emplaceBack(node.get(), *current);
+      ++current;
+    }
+  }
+  return node;
+}
+
 template < typename K, typename T, typename C >
 template < typename... Args >
 typename kizhin::Map< K, T, C >::Node* kizhin::Map< K, T, C >::emplaceToNode(Node* node,
@@ -1573,5 +1692,28 @@ void kizhin::swap(Map< K, T, C >& lhs, Map< K, T, C >& rhs) noexcept(
   lhs.swap(rhs);
 }
 
+template < typename MapT, typename RandomIt >
+MapT kizhin::makeMap(const RandomIt first, const RandomIt last,
+    const typename MapT::key_compare& comparator)
+{
+  auto keyLess = [&comparator](const auto& lhs, const auto& rhs) -> bool
+  {
+    return comparator(lhs.first, rhs.first);
+  };
+  auto keyEqual = [&keyLess](const auto& lhs, const auto& rhs) -> bool
+  {
+    return !keyLess(lhs, rhs) && !keyLess(rhs, lhs);
+  };
+  if (!std::is_sorted(first, last, keyLess)) {
+    std::stable_sort(first, last, keyLess);
+  }
+  const RandomIt uniqueLast = std::unique(first, last, keyEqual);
+  const auto move = [](RandomIt it) -> std::move_iterator< RandomIt >
+  {
+    return std::make_move_iterator(it);
+  };
+  return MapT(sortedUnique, move(first), move(uniqueLast), comparator);
+}
+
 #endif
 
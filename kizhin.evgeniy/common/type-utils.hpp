@@ -136,6 +136,19 @@ namespace kizhin {
   template < typename T >
   constexpr bool is_nothrow_move_assignable_v =
       detail::is_nothrow_move_assignable< T >::value;
+
+  namespace detail {
+    template < typename, typename = void >
+    struct is_transparent: std::false_type
+    {};
+
+    template < typename T >
+    struct is_transparent< T, void_t< typename T::is_transparent > >: std::true_type
+    {};
+  }
+
+  template < typename T >
+  constexpr bool is_transparent_v = detail::is_transparent< T >::value;
 }
 
 #endif
@@ -6,7 +6,9 @@
 #include <cmath>
 #include <functional>
 #include <stdexcept>
+#include <tuple>
 #include <utility>
+#include "type-utils.hpp"
 
 namespace kizhin {
   template < typename Key, typename T, typename Hash = std::hash< Key >,
@@ -29,10 +31,22 @@ namespace kizhin {
     template < bool isConst >
     class Iterator;
 
+    template < typename K >
+    using enable_if_transparent = std::enable_if_t< is_transparent_v< Hash > &&
+            is_transparent_v< KeyEqual > && !std::is_same< K, Key >::value,
+        int >;
+
   public:
     using iterator = Iterator< false >;
     using const_iterator = Iterator< true >;
 
+    struct ProbeStatistics
+    {
+      size_type tombstones;
+      size_type maxProbeLength;
+      float averageProbeLength;
+    };
+
     UnorderedMap() noexcept = default;
     UnorderedMap(const UnorderedMap&);
     UnorderedMap(UnorderedMap&&) noexcept;
@@ -53,16 +67,27 @@ namespace kizhin {
     const_iterator end() const noexcept;
 
     mapped_type& operator[](const key_type&);
+    mapped_type& operator[](key_type&&);
     mapped_type& at(const key_type&);
     const mapped_type& at(const key_type&) const;
 
     iterator find(const key_type&);
     const_iterator find(const key_type&) const;
+    template < typename K, typename = enable_if_transparent< K > >
+    iterator find(const K&);
+    template < typename K, typename = enable_if_transparent< K > >
+    const_iterator find(const K&) const;
     size_type count(const key_type&) const;
+    template < typename K, typename = enable_if_transparent< K > >
+    size_type count(const K&) const;
 
     template < typename... Args >
     std::pair< iterator, bool > emplace(Args&&...);
     template < typename... Args >
+    std::pair< iterator, bool > try_emplace(const key_type&, Args&&...);
+    template < typename... Args >
+    std::pair< iterator, bool > try_emplace(key_type&&, Args&&...);
+    template < typename... Args >
     iterator emplace_hint(const_iterator, Args&&...);
     std::pair< iterator, bool > insert(const value_type&);
     std::pair< iterator, bool > insert(value_type&&);
@@ -87,6 +112,9 @@ namespace kizhin {
     void rehash(size_type);
     void reserve(size_type);
 
+    size_type tombstoneCount() const noexcept;
+    ProbeStatistics probeStatistics() const;
+
     hasher hashFunc() const;
     key_equal keyEq() const;
 
@@ -96,7 +124,18 @@ namespace kizhin {
     Node* begin_ = nullptr;
     Node* end_ = nullptr;
     size_type size_ = 0;
+    size_type deleted_ = 0;
     float maxLoadFact_ = 0.75;
+
+    template < typename K >
+    Node* findNode(const K&) const;
+    template < typename K >
+    Node* findFreeNode(const K&) const;
+    Node* occupyNode(Node*) noexcept;
+    void prepareInsertion();
+    size_type probeLength(const Node*) const;
+    template < typename K, typename... Args >
+    std::pair< iterator, bool > tryEmplaceImpl(K&&, Args&&...);
   };
 
   template < typename K, typename T, typename H, typename E >
@@ -226,6 +265,7 @@ namespace kizhin {
     begin_(std::exchange(rhs.begin_, nullptr)),
     end_(std::exchange(rhs.end_, nullptr)),
     size_(std::exchange(rhs.size_, 0)),
+    deleted_(std::exchange(rhs.deleted_, 0)),
     maxLoadFact_(rhs.maxLoadFact_)
   {}
 
@@ -309,7 +349,14 @@ namespace kizhin {
   typename UnorderedMap< K, T, H, E >::mapped_type& UnorderedMap< K, T, H,
       E >::operator[](const key_type& key)
   {
-    return insert({ key, {} }).first->second;
+    return try_emplace(key).first->second;
+  }
+
+  template < typename K, typename T, typename H, typename E >
+  typename UnorderedMap< K, T, H, E >::mapped_type& UnorderedMap< K, T, H,
+      E >::operator[](key_type&& key)
+  {
+    return try_emplace(std::move(key)).first->second;
   }
 
   template < typename K, typename T, typename H, typename E >
@@ -344,28 +391,41 @@ namespace kizhin {
   typename UnorderedMap< K, T, H, E >::const_iterator UnorderedMap< K, T, H, E >::find(
       const key_type& key) const
   {
-    if (empty()) {
-      return end();
-    }
-    const size_type capacity = bucketCount();
-    Node* curr = begin_ + hashFunc()(key) % capacity;
-    const Node* const stop = curr == begin_ ? end_ : curr - 1;
-    while (curr != stop) {
-      pointer currVal = reinterpret_cast< pointer >(curr->value);
-      if (curr->state == Node::occupied && keyEq()(currVal->first, key)) {
-        return const_iterator{ curr, end_ };
-      }
-      ++curr;
-      curr = curr == end_ ? begin_ : curr;
-    }
-    return end();
+    Node* node = findNode(key);
+    return node ? const_iterator{ node, end_ } : end();
+  }
+
+  template < typename K, typename T, typename H, typename E >
+  template < typename Key, typename >
+  typename UnorderedMap< K, T, H, E >::iterator UnorderedMap< K, T, H, E >::find(
+      const Key& key)
+  {
+    Node* node = findNode(key);
+    return node ? iterator{ node, end_ } : end();
+  }
+
+  template < typename K, typename T, typename H, typename E >
+  template < typename Key, typename >
+  typename UnorderedMap< K, T, H, E >::const_iterator UnorderedMap< K, T, H, E >::find(
+      const Key& key) const
+  {
+    Node* node = findNode(key);
+    return node ? const_iterator{ node, end_ } : end();
   }
 
   template < typename K, typename T, typename H, typename E >
   typename UnorderedMap< K, T, H, E >::size_type UnorderedMap< K, T, H, E >::count(
       const key_type& key) const
   {
-    return static_cast< size_type >(find(key) != end());
+    return static_cast< size_type >(findNode(key) != nullptr);
+  }
+
+  template < typename K, typename T, typename H, typename E >
+  template < typename Key, typename >
+  typename UnorderedMap< K, T, H, E >::size_type UnorderedMap< K, T, H, E >::count(
+      const Key& key) const
+  {
+    return static_cast< size_type >(findNode(key) != nullptr);
   }
 
   template < typename K, typename T, typename H, typename E >
@@ -373,9 +433,7 @@ namespace kizhin {
   std::pair< typename UnorderedMap< K, T, H, E >::iterator, bool > UnorderedMap< K, T, H,
       E >::emplace(Args&&... args)
   {
-    if (loadFactor() >= maxLoadFactor()) {
-      rehash(std::max< size_type >(bucketCount() * 2, 4));
-    }
+    prepareInsertion();
     const size_type capacity = bucketCount();
     value_type value(std::forward< Args >(args)...);
     Node* curr = begin_ + hashFunc()(value.first) % capacity;
@@ -393,9 +451,23 @@ namespace kizhin {
     }
     curr = firstDeleted ? firstDeleted : curr;
     new (reinterpret_cast< pointer >(curr->value)) value_type(std::move(value));
-    curr->state = Node::occupied;
-    ++size_;
-    return std::make_pair(iterator{ curr, end_ }, true);
+    return std::make_pair(iterator{ occupyNode(curr), end_ }, true);
+  }
+
+  template < typename K, typename T, typename H, typename E >
+  template < typename... Args >
+  std::pair< typename UnorderedMap< K, T, H, E >::iterator, bool > UnorderedMap< K, T, H,
+      E >::try_emplace(const key_type& key, Args&&... args)
+  {
+    return tryEmplaceImpl(key, std::forward< Args >(args)...);
+  }
+
+  template < typename K, typename T, typename H, typename E >
+  template < typename... Args >
+  std::pair< typename UnorderedMap< K, T, H, E >::iterator, bool > UnorderedMap< K, T, H,
+      E >::try_emplace(key_type&& key, Args&&... args)
+  {
+    return tryEmplaceImpl(std::move(key), std::forward< Args >(args)...);
   }
 
   template < typename K, typename T, typename H, typename E >
@@ -455,10 +527,23 @@ namespace kizhin {
       const_iterator position)
   {
     assert(position != end() && "UnorderedMap: cannot erase element past the end");
-    position.node_->state = Node::deleted;
-    (reinterpret_cast< pointer >(position.node_->value))->~value_type();
+    Node* erased = position.node_;
+    (reinterpret_cast< pointer >(erased->value))->~value_type();
     ++position;
     --size_;
+    Node* next = erased + 1 == end_ ? begin_ : erased + 1;
+    if (next->state != Node::empty) {
+      erased->state = Node::deleted;
+      ++deleted_;
+      return iterator{ position.node_, position.end_ };
+    }
+    erased->state = Node::empty;
+    Node* prev = erased == begin_ ? end_ - 1 : erased - 1;
+    while (prev->state == Node::deleted) {
+      prev->state = Node::empty;
+      --deleted_;
+      prev = prev == begin_ ? end_ - 1 : prev - 1;
+    }
     return iterator{ position.node_, position.end_ };
   }
 
@@ -491,6 +576,7 @@ namespace kizhin {
     delete[] std::exchange(begin_, nullptr);
     end_ = nullptr;
     size_ = 0;
+    deleted_ = 0;
   }
 
   template < typename K, typename T, typename H, typename E >
@@ -500,6 +586,7 @@ namespace kizhin {
     swap(begin_, rhs.begin_);
     swap(end_, rhs.end_);
     swap(size_, rhs.size_);
+    swap(deleted_, rhs.deleted_);
     swap(maxLoadFact_, rhs.maxLoadFact_);
   }
 
@@ -541,9 +628,15 @@ namespace kizhin {
     UnorderedMap resized{};
     resized.begin_ = new Node[newBucketCount];
     resized.end_ = resized.begin_ + newBucketCount;
-    resized.insert(begin(), end());
+    resized.maxLoadFact_ = maxLoadFact_;
+    for (auto it = begin(); it != end(); ++it) {
+      Node* curr = resized.findFreeNode(it->first);
+      key_type& key = const_cast< key_type& >(it->first);
+      new (reinterpret_cast< pointer >(curr->value))
+          value_type(std::move_if_noexcept(key), std::move_if_noexcept(it->second));
+      resized.occupyNode(curr);
+    }
     swap(resized);
-    std::swap(maxLoadFact_, resized.maxLoadFact_);
   }
 
   template < typename K, typename T, typename H, typename E >
@@ -553,6 +646,32 @@ namespace kizhin {
     rehash(requiredBuckets);
   }
 
+  template < typename K, typename T, typename H, typename E >
+  typename UnorderedMap< K, T, H, E >::size_type UnorderedMap< K, T, H,
+      E >::tombstoneCount() const noexcept
+  {
+    return deleted_;
+  }
+
+  template < typename K, typename T, typename H, typename E >
+  typename UnorderedMap< K, T, H, E >::ProbeStatistics UnorderedMap< K, T, H,
+      E >::probeStatistics() const
+  {
+    ProbeStatistics result{ deleted_, 0, 0.0f };
+    size_type totalLength = 0;
+    for (const Node* curr = begin_; curr != end_; ++curr) {
+      if (curr->state == Node::occupied) {
+        const size_type length = probeLength(curr);
+        result.maxProbeLength = std::max(result.maxProbeLength, length);
+        totalLength += length;
+      }
+    }
+    if (!empty()) {
+      result.averageProbeLength = static_cast< float >(totalLength) / size();
+    }
+    return result;
+  }
+
   template < typename K, typename T, typename H, typename E >
   typename UnorderedMap< K, T, H, E >::hasher UnorderedMap< K, T, H, E >::hashFunc() const
   {
@@ -565,6 +684,96 @@ namespace kizhin {
     return key_equal{};
   }
 
+  template < typename K, typename T, typename H, typename E >
+  template < typename Key >
+  typename UnorderedMap< K, T, H, E >::Node* UnorderedMap< K, T, H, E >::findNode(
+      const Key& key) const
+  {
+    if (empty()) {
+      return nullptr;
+    }
+    const size_type capacity = bucketCount();
+    Node* curr = begin_ + hashFunc()(key) % capacity;
+    const Node* const start = curr;
+    do {
+      pointer currVal = reinterpret_cast< pointer >(curr->value);
+      if (curr->state == Node::occupied && keyEq()(currVal->first, key)) {
+        return curr;
+      }
+      ++curr;
+      curr = curr == end_ ? begin_ : curr;
+    } while (curr != start && curr->state != Node::empty);
+    return nullptr;
+  }
+
+  template < typename K, typename T, typename H, typename E >
+  template < typename Key >
+  typename UnorderedMap< K, T, H, E >::Node* UnorderedMap< K, T, H, E >::findFreeNode(
+      const Key& key) const
+  {
+    Node* curr = begin_ + hashFunc()(key) % bucketCount();
+    while (curr->state == Node::occupied) {
+      ++curr;
+      curr = curr == end_ ? begin_ : curr;
+    }
+    return curr;
+  }
+
+  template < typename K, typename T, typename H, typename E >
+  typename UnorderedMap< K, T, H, E >::Node* UnorderedMap< K, T, H, E >::occupyNode(
+      Node* node) noexcept
+  {
+    if (node->state == Node::deleted) {
+      --deleted_;
+    }
+    node->state = Node::occupied;
+    ++size_;
+    return node;
+  }
+
+  template < typename K, typename T, typename H, typename E >
+  void UnorderedMap< K, T, H, E >::prepareInsertion()
+  {
+    const size_type capacity = bucketCount();
+    const size_type used = size_ + deleted_ + 1;
+    const float usedFactor = capacity ? static_cast< float >(used) / capacity : 1.0f;
+    if (used < capacity && usedFactor <= maxLoadFact_) {
+      return;
+    }
+    if (deleted_ > size_) {
+      rehash(capacity);
+    } else {
+      rehash(std::max< size_type >(capacity * 2, 4));
+    }
+  }
+
+  template < typename K, typename T, typename H, typename E >
+  typename UnorderedMap< K, T, H, E >::size_type UnorderedMap< K, T, H, E >::probeLength(
+      const Node* node) const
+  {
+    const size_type capacity = bucketCount();
+    const size_type position = node - begin_;
+    const_pointer value = reinterpret_cast< const_pointer >(node->value);
+    const size_type home = hashFunc()(value->first) % capacity;
+    return (position + capacity - home) % capacity + 1;
+  }
+
+  template < typename K, typename T, typename H, typename E >
+  template < typename Key, typename... Args >
+  std::pair< typename UnorderedMap< K, T, H, E >::iterator, bool > UnorderedMap< K, T, H,
+      E >::tryEmplaceImpl(Key&& key, Args&&... args)
+  {
+    if (Node* existing = findNode(key)) {
+      return std::make_pair(iterator{ existing, end_ }, false);
+    }
+    prepareInsertion();
+    Node* curr = findFreeNode(key);
+    new (reinterpret_cast< pointer >(curr->value)) value_type(std::piecewise_construct,
+        std::forward_as_tuple(std::forward< Key >(key)),
+        std::forward_as_tuple(std::forward< Args >(args)...));
+    return std::make_pair(iterator{ occupyNode(curr), end_ }, true);
+  }
+
   template < typename K, typename T, typename H, typename E >
   void swap(UnorderedMap< K, T, H, E >& lhs, UnorderedMap< K, T, H, E >& rhs) noexcept(
       noexcept(lhs.swap(rhs)))
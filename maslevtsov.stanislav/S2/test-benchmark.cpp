@@ -0,0 +1,89 @@
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/test/unit_test.hpp>
+#include "queue.hpp"
+#include "stack.hpp"
+
+namespace {
+  using clock_type = std::chrono::steady_clock;
+
+  template< class F >
+  double measure_ns(std::size_t operations, F&& function)
+  {
+    double best = 0.0;
+    for (std::size_t repeat = 0; repeat != 5; ++repeat) {
+      clock_type::time_point start = clock_type::now();
+      function();
+      std::chrono::duration< double, std::nano > elapsed = clock_type::now() - start;
+      best = (repeat == 0 || elapsed.count() < best) ? elapsed.count() : best;
+    }
+    return best / operations;
+  }
+
+  template< class T >
+  T make_value(std::size_t i, T)
+  {
+    return static_cast< T >(i);
+  }
+
+  std::string make_value(std::size_t i, const std::string&)
+  {
+    return "token_" + std::to_string(i);
+  }
+
+  template< class T >
+  void run_throughput(const char* type_name, std::size_t elements)
+  {
+    std::vector< T > values;
+    for (std::size_t i = 0; i != elements; ++i) {
+      values.push_back(make_value(i, T()));
+    }
+    std::size_t checksum = 0;
+    double queue_ns = measure_ns(2 * elements, [&]()
+    {
+      maslevtsov::Queue< T > queue;
+      for (std::size_t i = 0; i != elements; ++i) {
+        queue.push(values[i]);
+      }
+      for (; !queue.empty(); queue.pop()) {
+        checksum += queue.size();
+      }
+    });
+    double stack_ns = measure_ns(2 * elements, [&]()
+    {
+      maslevtsov::Stack< T > stack;
+      for (std::size_t i = 0; i != elements; ++i) {
+        stack.push(values[i]);
+      }
+      for (; !stack.empty(); stack.pop()) {
+        checksum -= stack.size();
+      }
+    });
+    double reserved_ns = measure_ns(2 * elements, [&]()
+    {
+      maslevtsov::Queue< T > queue;
+      queue.reserve(elements);
+      for (std::size_t i = 0; i != elements; ++i) {
+        queue.push(values[i]);
+      }
+      for (; !queue.empty(); queue.pop()) {
+        checksum += queue.size();
+      }
+    });
+    std::cout << type_name << '\t' << elements << '\t' << queue_ns << '\t' << stack_ns << '\t' << reserved_ns << '\n';
+    BOOST_TEST(checksum == 5 * elements * (elements + 1) / 2);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(queue_stack_benchmark, *boost::unit_test::disabled())
+BOOST_AUTO_TEST_CASE(push_pop_throughput_test)
+{
+  std::cout << "type\telements\tqueue ns/op\tstack ns/op\treserved queue ns/op\n";
+  for (std::size_t elements = 1000; elements <= 1000000; elements *= 10) {
+    run_throughput< int >("int", elements);
+    run_throughput< std::string >("string", elements);
+  }
+}
+BOOST_AUTO_TEST_SUITE_END()
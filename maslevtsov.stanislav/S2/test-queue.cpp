@@ -1,3 +1,4 @@
+#include <string>
 #include <boost/test/unit_test.hpp>
 #include "queue.hpp"
 
@@ -36,6 +37,18 @@ BOOST_AUTO_TEST_CASE(queue_copy_assignment_operator_test)
   BOOST_TEST(q1.front() == q2.front());
   BOOST_TEST(q1.size() == q2.size());
 }
+
+BOOST_AUTO_TEST_CASE(queue_move_assignment_operator_test)
+{
+  maslevtsov::Queue< std::string > q1;
+  q1.push("first");
+  q1.push("second");
+  maslevtsov::Queue< std::string > q2;
+  q2.push("other");
+  q2 = std::move(q1);
+  BOOST_TEST(q2.size() == 2);
+  BOOST_TEST(q2.front() == "first");
+}
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(queue_elements_access_tests)
@@ -63,6 +76,20 @@ BOOST_AUTO_TEST_CASE(queue_size_test)
   q.push(1);
   BOOST_TEST(q.size() == 1);
 }
+
+BOOST_AUTO_TEST_CASE(queue_reserve_test)
+{
+  maslevtsov::Queue< std::string > q;
+  BOOST_TEST(q.capacity() == 0);
+  q.reserve(5);
+  BOOST_TEST(q.capacity() == 8);
+  q.push("a");
+  q.reserve(3);
+  BOOST_TEST(q.capacity() == 8);
+  q.reserve(9);
+  BOOST_TEST(q.capacity() == 16);
+  BOOST_TEST(q.front() == "a");
+}
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(queue_modifiers_tests)
@@ -106,4 +133,24 @@ BOOST_AUTO_TEST_CASE(queue_swap_test)
   BOOST_TEST(s2.front() == 1);
   BOOST_TEST(s2.size() == 1);
 }
+
+BOOST_AUTO_TEST_CASE(queue_wrap_around_test)
+{
+  maslevtsov::Queue< std::string > q;
+  std::size_t pushed = 0;
+  std::size_t popped = 0;
+  for (std::size_t i = 0; i != 100; ++i) {
+    q.push(std::to_string(pushed++));
+    q.push(std::to_string(pushed++));
+    BOOST_TEST(q.front() == std::to_string(popped++));
+    q.pop();
+  }
+  BOOST_TEST(q.size() == pushed - popped);
+  maslevtsov::Queue< std::string > copied(q);
+  for (; !q.empty(); q.pop(), copied.pop()) {
+    BOOST_TEST(q.front() == std::to_string(popped));
+    BOOST_TEST(copied.front() == std::to_string(popped++));
+  }
+  BOOST_TEST(copied.empty());
+}
 BOOST_AUTO_TEST_SUITE_END()
@@ -1,3 +1,4 @@
+#include <string>
 #include <boost/test/unit_test.hpp>
 #include "stack.hpp"
 
@@ -28,6 +29,18 @@ BOOST_AUTO_TEST_CASE(stack_copy_assignment_operator_test)
   BOOST_TEST(s1.top() == s2.top());
   BOOST_TEST(s1.size() == s2.size());
 }
+
+BOOST_AUTO_TEST_CASE(stack_move_assignment_operator_test)
+{
+  maslevtsov::Stack< std::string > s1;
+  s1.push("first");
+  s1.push("second");
+  maslevtsov::Stack< std::string > s2;
+  s2.push("other");
+  s2 = std::move(s1);
+  BOOST_TEST(s2.size() == 2);
+  BOOST_TEST(s2.top() == "second");
+}
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(stack_elements_access_tests)
@@ -56,6 +69,22 @@ BOOST_AUTO_TEST_CASE(stack_size_test)
   s.push(1);
   BOOST_TEST(s.size() == 1);
 }
+
+BOOST_AUTO_TEST_CASE(stack_reserve_test)
+{
+  maslevtsov::Stack< std::string > s;
+  s.reserve(100);
+  BOOST_TEST(s.capacity() == 128);
+  for (std::size_t i = 0; i != 128; ++i) {
+    s.push(std::to_string(i));
+  }
+  BOOST_TEST(s.capacity() == 128);
+  s.push("last");
+  BOOST_TEST(s.capacity() == 256);
+  BOOST_TEST(s.top() == "last");
+  s.pop();
+  BOOST_TEST(s.top() == "127");
+}
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(stack_modifiers_tests)
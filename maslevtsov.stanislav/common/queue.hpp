@@ -13,7 +13,9 @@ namespace maslevtsov {
 
     bool empty() const noexcept;
     std::size_t size() const noexcept;
+    std::size_t capacity() const noexcept;
 
+    void reserve(std::size_t new_capacity);
     void push(const T& value);
     void push(T&& value);
     void pop() noexcept;
@@ -48,6 +50,18 @@ std::size_t maslevtsov::Queue< T >::size() const noexcept
   return queue_base_.size();
 }
 
+template< class T >
+std::size_t maslevtsov::Queue< T >::capacity() const noexcept
+{
+  return queue_base_.capacity();
+}
+
+template< class T >
+void maslevtsov::Queue< T >::reserve(std::size_t new_capacity)
+{
+  queue_base_.reserve(new_capacity);
+}
+
 template< class T >
 void maslevtsov::Queue< T >::push(const T& value)
 {
@@ -1,6 +1,8 @@
 #ifndef QUEUE_STACK_BASE_HPP
 #define QUEUE_STACK_BASE_HPP
 
+#include <cstddef>
+#include <new>
 #include <utility>
 
 namespace maslevtsov {
@@ -21,16 +23,24 @@ namespace maslevtsov {
 
     bool empty() const noexcept;
     std::size_t size() const noexcept;
+    std::size_t capacity() const noexcept;
 
+    void reserve(std::size_t new_capacity);
     void push(const T& value);
     void push(T&& value);
     void pop() noexcept;
+    void clear() noexcept;
     void swap(QueueStackBase& other) noexcept;
 
   private:
     T* data_;
     std::size_t size_, first_, capacity_;
 
+    static T* allocate(std::size_t capacity);
+    static void deallocate(T* data) noexcept;
+    static std::size_t round_capacity(std::size_t capacity) noexcept;
+
+    std::size_t slot(std::size_t index) const noexcept;
     template< class U >
     void push_impl(U&& value);
     void expand_data(std::size_t new_capacity);
@@ -46,23 +56,18 @@ namespace maslevtsov {
 
   template< class T, bool is_pop_front >
   QueueStackBase< T, is_pop_front >::QueueStackBase(const QueueStackBase& rhs):
-    data_(new T[rhs.capacity_]),
-    size_(rhs.size_),
+    data_(allocate(rhs.capacity_)),
+    size_(0),
     first_(0),
     capacity_(rhs.capacity_)
   {
     try {
-      if (is_pop_front) {
-        for (std::size_t i = 0, j = rhs.first_; i != capacity_; ++i, j = (j + 1) % capacity_) {
-          data_[i] = rhs.data_[j];
-        }
-      } else {
-        for (std::size_t i = 0; i != capacity_; ++i) {
-          data_[i] = rhs.data_[i];
-        }
+      for (; size_ != rhs.size_; ++size_) {
+        new (data_ + size_) T(rhs[size_]);
       }
     } catch (...) {
-      delete[] data_;
+      clear();
+      deallocate(data_);
       throw;
     }
   }
@@ -78,7 +83,8 @@ namespace maslevtsov {
   template< class T, bool is_pop_front >
   QueueStackBase< T, is_pop_front >::~QueueStackBase()
   {
-    delete[] data_;
+    clear();
+    deallocate(data_);
   }
 
   template< class T, bool is_pop_front >
@@ -93,20 +99,20 @@ namespace maslevtsov {
   QueueStackBase< T, is_pop_front >& QueueStackBase< T, is_pop_front >::operator=(QueueStackBase&& rhs) noexcept
   {
     QueueStackBase< T, is_pop_front > moved(std::move(rhs));
-    swap(rhs);
+    swap(moved);
     return *this;
   }
 
   template< class T, bool is_pop_front >
   T& QueueStackBase< T, is_pop_front >::operator[](std::size_t index) noexcept
   {
-    return data_[is_pop_front ? ((first_ + index) % capacity_) : (size_ - 1)];
+    return data_[slot(index)];
   }
 
   template< class T, bool is_pop_front >
   const T& QueueStackBase< T, is_pop_front >::operator[](std::size_t index) const noexcept
   {
-    return data_[is_pop_front ? ((first_ + index) % capacity_) : (size_ - 1)];
+    return data_[slot(index)];
   }
 
   template< class T, bool is_pop_front >
@@ -121,6 +127,20 @@ namespace maslevtsov {
     return size_;
   }
 
+  template< class T, bool is_pop_front >
+  std::size_t QueueStackBase< T, is_pop_front >::capacity() const noexcept
+  {
+    return capacity_;
+  }
+
+  template< class T, bool is_pop_front >
+  void QueueStackBase< T, is_pop_front >::reserve(std::size_t new_capacity)
+  {
+    if (new_capacity > capacity_) {
+      expand_data(round_capacity(new_capacity));
+    }
+  }
+
   template< class T, bool is_pop_front >
   void QueueStackBase< T, is_pop_front >::push(const T& value)
   {
@@ -137,11 +157,23 @@ namespace maslevtsov {
   void QueueStackBase< T, is_pop_front >::pop() noexcept
   {
     if (is_pop_front) {
-      first_ = (first_ + 1) % capacity_;
+      data_[first_].~T();
+      first_ = (first_ + 1) & (capacity_ - 1);
+    } else {
+      data_[size_ - 1].~T();
     }
     --size_;
   }
 
+  template< class T, bool is_pop_front >
+  void QueueStackBase< T, is_pop_front >::clear() noexcept
+  {
+    while (!empty()) {
+      pop();
+    }
+    first_ = 0;
+  }
+
   template< class T, bool is_pop_front >
   void QueueStackBase< T, is_pop_front >::swap(QueueStackBase& other) noexcept
   {
@@ -151,38 +183,70 @@ namespace maslevtsov {
     std::swap(capacity_, other.capacity_);
   }
 
+  template< class T, bool is_pop_front >
+  T* QueueStackBase< T, is_pop_front >::allocate(std::size_t capacity)
+  {
+    return capacity == 0 ? nullptr : static_cast< T* >(::operator new(capacity * sizeof(T)));
+  }
+
+  template< class T, bool is_pop_front >
+  void QueueStackBase< T, is_pop_front >::deallocate(T* data) noexcept
+  {
+    ::operator delete(data);
+  }
+
+  template< class T, bool is_pop_front >
+  std::size_t QueueStackBase< T, is_pop_front >::round_capacity(std::size_t capacity) noexcept
+  {
+    std::size_t result = 1;
+    while (result < capacity) {
+      result *= 2;
+    }
+    return result;
+  }
+
+  template< class T, bool is_pop_front >
+  std::size_t QueueStackBase< T, is_pop_front >::slot(std::size_t index) const noexcept
+  {
+    return is_pop_front ? ((first_ + index) & (capacity_ - 1)) : index;
+  }
+
   template< class T, bool is_pop_front >
   template< class U >
   void QueueStackBase< T, is_pop_front >::push_impl(U&& value)
   {
     if (size_ == capacity_) {
-      expand_data(size_ * 2 + 1);
+      T pushed(std::forward< U >(value));
+      expand_data(capacity_ == 0 ? 4 : capacity_ * 2);
+      new (data_ + slot(size_)) T(std::move_if_noexcept(pushed));
+    } else {
+      new (data_ + slot(size_)) T(std::forward< U >(value));
     }
-    data_[size_++] = std::forward< U >(value);
+    ++size_;
   }
 
   template< class T, bool is_pop_front >
   void QueueStackBase< T, is_pop_front >::expand_data(std::size_t new_capacity)
   {
-    T* new_data = new T[new_capacity];
+    T* new_data = allocate(new_capacity);
+    std::size_t moved = 0;
     try {
-      if (is_pop_front) {
-        for (std::size_t i = 0, j = first_; i != capacity_; ++i, j = (j + 1) % capacity_) {
-          new_data[i] = data_[j];
-        }
-      } else {
-        for (std::size_t i = 0; i != capacity_; ++i) {
-          new_data[i] = data_[i];
-        }
+      for (; moved != size_; ++moved) {
+        new (new_data + moved) T(std::move_if_noexcept((*this)[moved]));
       }
     } catch (...) {
-      delete[] new_data;
+      for (std::size_t i = 0; i != moved; ++i) {
+        new_data[i].~T();
+      }
+      deallocate(new_data);
       throw;
     }
-    delete[] data_;
+    std::size_t count = size_;
+    clear();
+    deallocate(data_);
     data_ = new_data;
+    size_ = count;
     capacity_ = new_capacity;
-    first_ = 0;
   }
 }
 
@@ -13,7 +13,9 @@ namespace maslevtsov {
 
     bool empty() const noexcept;
     std::size_t size() const noexcept;
+    std::size_t capacity() const noexcept;
 
+    void reserve(std::size_t new_capacity);
     void push(const T& value);
     void push(T&& value);
     void pop() noexcept;
@@ -48,6 +50,18 @@ std::size_t maslevtsov::Stack< T >::size() const noexcept
   return stack_base_.size();
 }
 
+template< class T >
+std::size_t maslevtsov::Stack< T >::capacity() const noexcept
+{
+  return stack_base_.capacity();
+}
+
+template< class T >
+void maslevtsov::Stack< T >::reserve(std::size_t new_capacity)
+{
+  stack_base_.reserve(new_capacity);
+}
+
 template< class T >
 void maslevtsov::Stack< T >::push(const T& value)
 {
@@ -1,37 +1,35 @@
 #include <iostream>
 #include <string>
-#include <stdexcept>
 #include <limits>
 #include <list.hpp>
+#include "scanner.hpp"
 
 int main()
 {
   rychkov::List< std::pair< std::string, rychkov::List< size_t > > > entered;
-  std::string name;
-  while (std::cin >> name)
+  rychkov::WordScanner scanner(std::cin);
+  const char* begin = nullptr;
+  const char* end = nullptr;
+  while (scanner.next(begin, end))
   {
-    try
+    size_t number = 0;
+    switch (rychkov::scan_number(begin, end, number))
     {
-      size_t processed = 0;
-      size_t number = std::stoull(name, &processed);
-      if (processed != name.size())
-      {
-        std::cerr << "int suffix is not supplied\n";
-        return 1;
-      }
+    case rychkov::NumberStatus::number:
       if (entered.empty())
       {
         std::cerr << "missing name in input\n";
         return 1;
       }
       entered.back().second.push_back(number);
-    }
-    catch (const std::invalid_argument&)
-    {
-      entered.push_back({name, {}});
-    }
-    catch (const std::out_of_range&)
-    {
+      break;
+    case rychkov::NumberStatus::not_number:
+      entered.push_back({std::string(begin, end), {}});
+      break;
+    case rychkov::NumberStatus::bad_suffix:
+      std::cerr << "int suffix is not supplied\n";
+      return 1;
+    case rychkov::NumberStatus::overflow:
       std::cerr << "input overflow\n";
       return 1;
     }
@@ -0,0 +1,89 @@
+#include "scanner.hpp"
+
+#include <istream>
+#include <limits>
+#include <utility>
+
+namespace
+{
+  bool is_space(char c) noexcept
+  {
+    return (c == ' ') || ((c >= '\t') && (c <= '\r'));
+  }
+  std::string read_all(std::istream& in)
+  {
+    constexpr size_t chunk_size = 1 << 16;
+    std::string result;
+    size_t size = 0;
+    do
+    {
+      result.resize(size + chunk_size);
+      in.read(&result[size], chunk_size);
+      size += static_cast< size_t >(in.gcount());
+    }
+    while (in);
+    result.resize(size);
+    return result;
+  }
+}
+
+rychkov::NumberStatus rychkov::scan_number(const char* begin, const char* end, size_t& result) noexcept
+{
+  bool negative = false;
+  if ((begin != end) && ((*begin == '+') || (*begin == '-')))
+  {
+    negative = (*begin == '-');
+    ++begin;
+  }
+  if ((begin == end) || (*begin < '0') || (*begin > '9'))
+  {
+    return NumberStatus::not_number;
+  }
+  constexpr size_t max = std::numeric_limits< size_t >::max();
+  size_t value = 0;
+  bool overflow = false;
+  for (; (begin != end) && (*begin >= '0') && (*begin <= '9'); ++begin)
+  {
+    size_t digit = static_cast< size_t >(*begin - '0');
+    overflow = overflow || (value > (max - digit) / 10);
+    value = value * 10 + digit;
+  }
+  if (overflow)
+  {
+    return NumberStatus::overflow;
+  }
+  if (begin != end)
+  {
+    return NumberStatus::bad_suffix;
+  }
+  result = negative ? 0 - value : value;
+  return NumberStatus::number;
+}
+
+rychkov::WordScanner::WordScanner(std::istream& in):
+  WordScanner(read_all(in))
+{}
+rychkov::WordScanner::WordScanner(std::string buffer) noexcept:
+  buffer_(std::move(buffer)),
+  pos_(0)
+{}
+bool rychkov::WordScanner::next(const char*& begin, const char*& end) noexcept
+{
+  const char* data = buffer_.data();
+  size_t size = buffer_.size();
+  while ((pos_ < size) && is_space(data[pos_]))
+  {
+    pos_++;
+  }
+  if (pos_ == size)
+  {
+    return false;
+  }
+  begin = data + pos_;
+  while ((pos_ < size) && !is_space(data[pos_]))
+  {
+    pos_++;
+  }
+  end = data + pos_;
+  return true;
+}
@@ -0,0 +1,33 @@
+#ifndef SCANNER_HPP
+#define SCANNER_HPP
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+
+namespace rychkov
+{
+  enum class NumberStatus
+  {
+    number,
+    not_number,
+    bad_suffix,
+    overflow
+  };
+
+  NumberStatus scan_number(const char* begin, const char* end, size_t& result) noexcept;
+
+  class WordScanner
+  {
+  public:
+    explicit WordScanner(std::istream& in);
+    explicit WordScanner(std::string buffer) noexcept;
+
+    bool next(const char*& begin, const char*& end) noexcept;
+  private:
+    std::string buffer_;
+    size_t pos_;
+  };
+}
+
+#endif
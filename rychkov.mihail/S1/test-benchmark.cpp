@@ -0,0 +1,106 @@
+#include <string>
+#include <sstream>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <boost/test/unit_test.hpp>
+#include "scanner.hpp"
+
+namespace
+{
+  using clock = std::chrono::steady_clock;
+
+  struct ScanResult
+  {
+    size_t names = 0;
+    size_t numbers = 0;
+    size_t sum = 0;
+  };
+
+  std::string generate_input(size_t sequences, size_t numbers)
+  {
+    std::string result;
+    for (size_t i = 0; i < sequences; i++)
+    {
+      result += "seq" + std::to_string(i);
+      for (size_t j = 0; j < numbers; j++)
+      {
+        result += ' ' + std::to_string(i * 31 + j);
+      }
+      result += '\n';
+    }
+    return result;
+  }
+
+  ScanResult scan_with_exceptions(std::istream& in)
+  {
+    ScanResult result;
+    std::string word;
+    while (in >> word)
+    {
+      try
+      {
+        result.sum += std::stoull(word);
+        result.numbers++;
+      }
+      catch (const std::invalid_argument&)
+      {
+        result.names++;
+      }
+    }
+    return result;
+  }
+  ScanResult scan_with_status(std::istream& in)
+  {
+    ScanResult result;
+    rychkov::WordScanner scanner(in);
+    const char* begin = nullptr;
+    const char* end = nullptr;
+    while (scanner.next(begin, end))
+    {
+      size_t number = 0;
+      if (rychkov::scan_number(begin, end, number) == rychkov::NumberStatus::number)
+      {
+        result.sum += number;
+        result.numbers++;
+      }
+      else
+      {
+        result.names++;
+      }
+    }
+    return result;
+  }
+
+  template< class F >
+  ScanResult measure(const char* name, const std::string& input, size_t numbers, F&& function)
+  {
+    std::istringstream in(input);
+    clock::time_point start = clock::now();
+    ScanResult result = function(in);
+    std::chrono::duration< double > elapsed = clock::now() - start;
+    std::cout << name << '\t' << result.names << '\t' << numbers << '\t' << elapsed.count() * 1000;
+    std::cout << '\t' << input.size() / elapsed.count() / (1 << 20) << '\n';
+    return result;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(S1_scanner_benchmark, *boost::unit_test::disabled())
+
+BOOST_AUTO_TEST_CASE(sequence_input_throughput)
+{
+  constexpr size_t sequences = 1000000;
+  std::cout << "reader\tsequences\tnumbers per sequence\tms\tMiB/s\n";
+  for (size_t numbers: {0, 1, 4})
+  {
+    std::string input = generate_input(sequences, numbers);
+    ScanResult old_result = measure("stoull", input, numbers, scan_with_exceptions);
+    ScanResult new_result = measure("scanner", input, numbers, scan_with_status);
+    BOOST_TEST(old_result.names == sequences);
+    BOOST_TEST(new_result.names == sequences);
+    BOOST_TEST(new_result.numbers == old_result.numbers);
+    BOOST_TEST(new_result.sum == old_result.sum);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
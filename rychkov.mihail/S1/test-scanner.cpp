@@ -0,0 +1,57 @@
+#include <sstream>
+#include <string>
+#include <limits>
+#include <boost/test/unit_test.hpp>
+#include "scanner.hpp"
+
+namespace
+{
+  rychkov::NumberStatus scan(const std::string& word, size_t& result)
+  {
+    return rychkov::scan_number(word.data(), word.data() + word.size(), result);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(S1_scanner_test)
+
+BOOST_AUTO_TEST_CASE(number_test)
+{
+  size_t result = 0;
+  BOOST_TEST((scan("0", result) == rychkov::NumberStatus::number));
+  BOOST_TEST(result == 0);
+  BOOST_TEST((scan("+42", result) == rychkov::NumberStatus::number));
+  BOOST_TEST(result == 42);
+  BOOST_TEST((scan("18446744073709551615", result) == rychkov::NumberStatus::number));
+  BOOST_TEST(result == std::numeric_limits< size_t >::max());
+  BOOST_TEST((scan("-1", result) == rychkov::NumberStatus::number));
+  BOOST_TEST(result == std::stoull("-1"));
+}
+BOOST_AUTO_TEST_CASE(classify_test)
+{
+  size_t result = 7;
+  BOOST_TEST((scan("first", result) == rychkov::NumberStatus::not_number));
+  BOOST_TEST((scan("-", result) == rychkov::NumberStatus::not_number));
+  BOOST_TEST((scan("+x1", result) == rychkov::NumberStatus::not_number));
+  BOOST_TEST((scan("12ab", result) == rychkov::NumberStatus::bad_suffix));
+  BOOST_TEST((scan("18446744073709551616", result) == rychkov::NumberStatus::overflow));
+  BOOST_TEST((scan("-99999999999999999999", result) == rychkov::NumberStatus::overflow));
+  BOOST_TEST((scan("99999999999999999999x", result) == rychkov::NumberStatus::overflow));
+  BOOST_TEST(result == 7);
+}
+BOOST_AUTO_TEST_CASE(word_scanner_test)
+{
+  std::istringstream in("  first 1\t2\n\nsecond\r\v3 ");
+  rychkov::WordScanner scanner(in);
+  const char* begin = nullptr;
+  const char* end = nullptr;
+  const char* expected[] = {"first", "1", "2", "second", "3"};
+  for (const char* word: expected)
+  {
+    BOOST_TEST(scanner.next(begin, end));
+    BOOST_TEST(std::string(begin, end) == word);
+  }
+  BOOST_TEST(!scanner.next(begin, end));
+  BOOST_TEST(!rychkov::WordScanner("").next(begin, end));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,323 @@
+#include "calculator.hpp"
+
+#include <atomic>
+#include <cctype>
+#include <condition_variable>
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include <safe_math.hpp>
+#include <spsc_queue.hpp>
+
+namespace rychkov
+{
+  namespace details
+  {
+    int getPriority(Operator oper)
+    {
+      switch (oper)
+      {
+      case openinigParenthesis:
+      case closingParenthesis:
+        return 1;
+      case modulus:
+        return 2;
+      case plus:
+      case minus:
+        return 3;
+      case multiplies:
+      case divides:
+        return 4;
+      default:
+        return -1;
+      }
+    }
+    bool lessPriority(Operator lhs, Operator rhs)
+    {
+      return getPriority(lhs) < getPriority(rhs);
+    }
+    bool equalPriority(Operator lhs, Operator rhs)
+    {
+      return getPriority(lhs) == getPriority(rhs);
+    }
+    bool isOperator(char c)
+    {
+      return getPriority(static_cast< Operator >(c)) != -1;
+    }
+    Operator popLowPrioritized(Queue< Token >& expression, Stack< Operator >& operators,
+          Operator referenceOperator = static_cast< Operator >('\0'))
+    {
+      while (!operators.empty() && lessPriority(referenceOperator, operators.top()))
+      {
+        expression.push(operators.top());
+        operators.pop();
+      }
+      Operator result = static_cast< Operator >('\0');
+      if (!operators.empty() && equalPriority(operators.top(), referenceOperator))
+      {
+        result = operators.top();
+        if (operators.top() != '(')
+        {
+          expression.push(operators.top());
+        }
+        operators.pop();
+      }
+      return result;
+    }
+    bool evaluate(Queue< Token >& expression, Stack< long long >& results, std::ostream& err)
+    {
+      Stack< long long > operands;
+      if (!holds_alternative< long long >(expression.front()))
+      {
+        err << "expression does not start with number\n";
+        return false;
+      }
+      operands.push(get< long long >(expression.front()));
+      expression.pop();
+      for (; !expression.empty(); expression.pop())
+      {
+        if (holds_alternative< Operator >(expression.front()))
+        {
+          if (operands.size() < 2)
+          {
+            err << "missing operand (number)\n";
+            return false;
+          }
+          long long rightOperand = operands.top();
+          operands.pop();
+          try
+          {
+            operands.top() = executeOperation(operands.top(), get< Operator >(expression.front()), rightOperand);
+          }
+          catch (const std::invalid_argument& e)
+          {
+            err << e.what() << '\n';
+            return false;
+          }
+        }
+        else
+        {
+          operands.push(get< long long >(expression.front()));
+        }
+      }
+      if (operands.size() != 1)
+      {
+        err << "missing operator\n";
+        return false;
+      }
+      results.push(operands.top());
+      return true;
+    }
+
+    constexpr size_t pipelineBatch = 64;
+
+    struct PipelineSync
+    {
+      std::mutex mutex;
+      std::condition_variable changed;
+      std::atomic< bool > stopped{false};
+      std::atomic< bool > producerWaiting{false};
+      std::atomic< bool > consumerWaiting{false};
+
+      template< class Predicate >
+      void wait(std::atomic< bool >& waiting, Predicate ready)
+      {
+        waiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!ready())
+        {
+          std::unique_lock< std::mutex > lock(mutex);
+          changed.wait(lock, ready);
+        }
+        waiting.store(false, std::memory_order_relaxed);
+      }
+      void wake(const std::atomic< bool >& waiting)
+      {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiting.load(std::memory_order_relaxed))
+        {
+          notify();
+        }
+      }
+      void notify()
+      {
+        {
+          std::lock_guard< std::mutex > lock(mutex);
+        }
+        changed.notify_all();
+      }
+    };
+    struct ProducerJoin
+    {
+      std::thread& producer;
+      PipelineSync& sync;
+
+      ~ProducerJoin()
+      {
+        sync.stopped.store(true);
+        sync.notify();
+        producer.join();
+      }
+    };
+  }
+}
+
+void rychkov::read_line(std::istream& in, TokenLine& line)
+{
+  bool isNumber = false;
+  long long number = 0;
+  char c = 0;
+  while (in >> c)
+  {
+    if (std::isdigit(c))
+    {
+      isNumber = true;
+      try
+      {
+        number = safeMul< long long >(number, 10);
+        number = safeAdd< long long >(number, c - '0');
+      }
+      catch (...)
+      {
+        line.error = "input overflow";
+        return;
+      }
+    }
+    else
+    {
+      if (isNumber)
+      {
+        line.tokens.push(number);
+        isNumber = false;
+        number = 0;
+      }
+      if (c == '\n')
+      {
+        return;
+      }
+      if (!std::isspace(c))
+      {
+        if (!details::isOperator(c))
+        {
+          line.error = std::string("found unknown symbol - '") + c + '\'';
+          return;
+        }
+        line.tokens.push(static_cast< Operator >(c));
+      }
+    }
+  }
+}
+bool rychkov::process_line(TokenLine& line, Stack< long long >& results, std::ostream& err)
+{
+  Queue< Token > expression;
+  Stack< Operator > operators;
+  for (; !line.tokens.empty(); line.tokens.pop())
+  {
+    if (holds_alternative< long long >(line.tokens.front()))
+    {
+      expression.push(get< long long >(line.tokens.front()));
+      continue;
+    }
+    Operator oper = get< Operator >(line.tokens.front());
+    if (oper == '(')
+    {
+      operators.push(oper);
+      continue;
+    }
+    Operator equalPrioritized = details::popLowPrioritized(expression, operators, oper);
+    if ((equalPrioritized != '(') && (oper == ')'))
+    {
+      err << "wrong parentheses order\n";
+      return false;
+    }
+    if (oper != ')')
+    {
+      operators.push(oper);
+    }
+  }
+  if (!line.error.empty())
+  {
+    err << line.error << '\n';
+    return false;
+  }
+  details::popLowPrioritized(expression, operators);
+  return expression.empty() || details::evaluate(expression, results, err);
+}
+bool rychkov::calculate(std::istream& in, Stack< long long >& results, std::ostream& err)
+{
+  in >> std::noskipws;
+  while (!in.eof())
+  {
+    TokenLine line;
+    read_line(in, line);
+    if (!process_line(line, results, err))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+bool rychkov::calculate_pipelined(std::istream& in, Stack< long long >& results, std::ostream& err)
+{
+  in >> std::noskipws;
+  SpscQueue< TokenLine > lines(256);
+  details::PipelineSync sync;
+  std::thread producer([&in, &lines, &sync]()
+  {
+    for (bool last = false; !last;)
+    {
+      TokenLine line;
+      try
+      {
+        read_line(in, line);
+      }
+      catch (const std::exception& e)
+      {
+        line.error = e.what();
+      }
+      last = in.eof() || !line.error.empty();
+      line.last = last;
+      if (!lines.try_push(std::move(line)))
+      {
+        sync.wait(sync.producerWaiting, [&lines, &sync]()
+        {
+          return sync.stopped || (lines.size() < lines.capacity());
+        });
+        if (sync.stopped)
+        {
+          return;
+        }
+        lines.push(std::move(line));
+      }
+      if (last || (lines.size() >= details::pipelineBatch))
+      {
+        sync.wake(sync.consumerWaiting);
+      }
+    }
+  });
+  details::ProducerJoin join{producer, sync};
+
+  bool result = true;
+  for (bool last = false; result && !last;)
+  {
+    if (lines.empty())
+    {
+      sync.wait(sync.consumerWaiting, [&lines]()
+      {
+        return !lines.empty();
+      });
+    }
+    last = lines.front().last;
+    result = process_line(lines.front(), results, err);
+    lines.pop();
+    if (lines.size() <= lines.capacity() - details::pipelineBatch)
+    {
+      sync.wake(sync.producerWaiting);
+    }
+  }
+  return result;
+}
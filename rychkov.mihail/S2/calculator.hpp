@@ -0,0 +1,36 @@
+#ifndef CALCULATOR_HPP
+#define CALCULATOR_HPP
+
+#include <iosfwd>
+#include <string>
+#include <queue.hpp>
+#include <stack.hpp>
+#include <variant.hpp>
+
+namespace rychkov
+{
+  enum Operator: char
+  {
+    plus = '+',
+    minus = '-',
+    multiplies = '*',
+    divides = '/',
+    modulus = '%',
+    openinigParenthesis = '(',
+    closingParenthesis = ')',
+  };
+  using Token = Variant< long long, Operator >;
+  struct TokenLine
+  {
+    Queue< Token > tokens;
+    std::string error;
+    bool last = false;
+  };
+
+  void read_line(std::istream& in, TokenLine& line);
+  bool process_line(TokenLine& line, Stack< long long >& results, std::ostream& err);
+  bool calculate(std::istream& in, Stack< long long >& results, std::ostream& err);
+  bool calculate_pipelined(std::istream& in, Stack< long long >& results, std::ostream& err);
+}
+
+#endif
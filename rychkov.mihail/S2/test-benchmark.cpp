@@ -0,0 +1,83 @@
+#include <string>
+#include <random>
+#include <chrono>
+#include <sstream>
+#include <iostream>
+#include <boost/test/unit_test.hpp>
+#include "calculator.hpp"
+
+namespace
+{
+  using clock = std::chrono::steady_clock;
+
+  std::string generate_expressions(size_t lines, size_t operands)
+  {
+    std::minstd_rand engine(17);
+    const char operators[] = "*%";
+    std::string result;
+    for (size_t i = 0; i < lines; i++)
+    {
+      result += std::to_string(engine() % 1000 + 1);
+      for (size_t j = 1; j < operands; j++)
+      {
+        result += (j % 2 == 0) ? " + ( " : " - ( ";
+        result += std::to_string(engine() % 100 + 1) + ' ' + operators[engine() % 2] + ' ';
+        result += std::to_string(engine() % 10 + 1) + " )";
+      }
+      result += '\n';
+    }
+    return result;
+  }
+
+  bool tokenize_only(std::istream& in, rychkov::Stack< long long >& results, std::ostream&)
+  {
+    in >> std::noskipws;
+    while (!in.eof())
+    {
+      rychkov::TokenLine line;
+      rychkov::read_line(in, line);
+      results.push(line.tokens.size());
+    }
+    results.pop();
+    return true;
+  }
+
+  template< class F >
+  double measure_ms(const std::string& text, size_t& results, F&& function)
+  {
+    std::istringstream in(text);
+    std::ostringstream err;
+    rychkov::Stack< long long > stack;
+    clock::time_point start = clock::now();
+    BOOST_TEST(function(in, stack, err));
+    std::chrono::duration< double, std::milli > elapsed = clock::now() - start;
+    results = stack.size();
+    return elapsed.count();
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(S2_pipeline_benchmark, *boost::unit_test::disabled())
+
+BOOST_AUTO_TEST_CASE(expression_file_test)
+{
+  std::cout << "lines\toperands\tMiB\ttokenize ms\tsequential ms\tpipelined ms\tspeedup\n";
+  for (size_t operands: {2, 16, 128})
+  {
+    size_t lines = 4000000 / operands;
+    std::string text = generate_expressions(lines, operands);
+    size_t tokenizedLines = 0;
+    size_t sequentialResults = 0;
+    size_t pipelinedResults = 0;
+    double tokenize = measure_ms(text, tokenizedLines, tokenize_only);
+    double sequential = measure_ms(text, sequentialResults, rychkov::calculate);
+    double pipelined = measure_ms(text, pipelinedResults, rychkov::calculate_pipelined);
+    std::cout << lines << '\t' << operands << '\t' << text.size() / double(1 << 20) << '\t' << tokenize;
+    std::cout << '\t' << sequential;
+    std::cout << '\t' << pipelined << '\t' << sequential / pipelined << '\n';
+    BOOST_TEST(tokenizedLines == lines);
+    BOOST_TEST(sequentialResults == lines);
+    BOOST_TEST(pipelinedResults == lines);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
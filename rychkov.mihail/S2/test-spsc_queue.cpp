@@ -0,0 +1,102 @@
+#include <string>
+#include <thread>
+#include <sstream>
+#include <boost/test/unit_test.hpp>
+#include <spsc_queue.hpp>
+#include <mem_checker.hpp>
+#include "calculator.hpp"
+
+BOOST_AUTO_TEST_SUITE(S2_spsc_queue_test)
+
+BOOST_AUTO_TEST_CASE(single_thread_test)
+{
+  rychkov::SpscQueue< std::string > queue(3);
+  BOOST_TEST(queue.capacity() == 4);
+  BOOST_TEST(queue.empty());
+  queue.push("first");
+  BOOST_TEST(queue.try_push("second"));
+  queue.emplace(3, 'c');
+  BOOST_TEST(queue.try_emplace("fourth"));
+  BOOST_TEST(!queue.try_push("fifth"));
+  BOOST_TEST(queue.size() == 4);
+  BOOST_TEST(queue.front() == "first");
+  queue.pop();
+  BOOST_TEST(queue.front() == "second");
+  queue.pop();
+  BOOST_TEST(queue.front() == "ccc");
+  BOOST_TEST(queue.try_push("fifth"));
+  BOOST_TEST(queue.size() == 3);
+}
+BOOST_AUTO_TEST_CASE(two_threads_test)
+{
+  constexpr size_t count = 200000;
+  rychkov::SpscQueue< size_t > queue(64);
+  std::thread producer([&queue]()
+  {
+    for (size_t i = 0; i < count; i++)
+    {
+      queue.push(i);
+    }
+  });
+  bool ordered = true;
+  for (size_t i = 0; i < count; i++)
+  {
+    while (queue.empty())
+    {
+      std::this_thread::yield();
+    }
+    ordered = ordered && (queue.front() == i);
+    queue.pop();
+  }
+  producer.join();
+  BOOST_TEST(ordered);
+  BOOST_TEST(queue.empty());
+}
+BOOST_AUTO_TEST_CASE(destructors_leak_test)
+{
+  struct A
+  {};
+  rychkov::MemTrack< A > observer{};
+  rychkov::SpscQueue< rychkov::MemChecker< A > > queue(4);
+  queue.emplace();
+  queue.emplace();
+  queue.pop();
+  queue.emplace();
+}
+BOOST_AUTO_TEST_CASE(pipelined_calculation_test)
+{
+  std::string text;
+  for (int i = 0; i < 2000; i++)
+  {
+    text += std::to_string(i) + " + ( " + std::to_string(i % 7) + " * 3 ) % 5\n\n";
+  }
+  std::istringstream in1(text);
+  std::istringstream in2(text);
+  std::ostringstream err1;
+  std::ostringstream err2;
+  rychkov::Stack< long long > results1;
+  rychkov::Stack< long long > results2;
+  BOOST_TEST(rychkov::calculate(in1, results1, err1));
+  BOOST_TEST(rychkov::calculate_pipelined(in2, results2, err2));
+  BOOST_TEST(results1.size() == 2000);
+  BOOST_TEST(results2.size() == results1.size());
+  bool equal = true;
+  for (; !results1.empty(); results1.pop(), results2.pop())
+  {
+    equal = equal && (results1.top() == results2.top());
+  }
+  BOOST_TEST(equal);
+
+  std::istringstream wrong("1 + 2\n3 ) x\n4 + 4\n");
+  BOOST_TEST(!rychkov::calculate_pipelined(wrong, results2, err2));
+  BOOST_TEST(err2.str() == "wrong parentheses order\n");
+  BOOST_TEST(results2.size() == 1);
+
+  std::istringstream early("1 )\n" + text);
+  std::ostringstream err3;
+  BOOST_TEST(!rychkov::calculate_pipelined(early, results2, err3));
+  BOOST_TEST(err3.str() == "wrong parentheses order\n");
+  BOOST_TEST(results2.size() == 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
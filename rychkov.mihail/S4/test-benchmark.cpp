@@ -0,0 +1,209 @@
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <iostream>
+#include <algorithm>
+#include <initializer_list>
+#include <boost/test/unit_test.hpp>
+#include <map.hpp>
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#include <malloc.h>
+#define RYCHKOV_HAS_MALLINFO2
+#endif
+
+namespace
+{
+  using clock = std::chrono::steady_clock;
+
+  template< class F >
+  double measure_ns(size_t operations, F&& function)
+  {
+    clock::time_point start = clock::now();
+    function();
+    std::chrono::duration< double, std::nano > elapsed = clock::now() - start;
+    return elapsed.count() / operations;
+  }
+
+  std::vector< int > generate_keys(size_t size, int)
+  {
+    std::vector< int > result(size);
+    for (size_t i = 0; i < size; i++)
+    {
+      result[i] = static_cast< int >(i * 2);
+    }
+    return result;
+  }
+  std::vector< std::string > generate_keys(size_t size, const std::string&)
+  {
+    std::vector< std::string > result(size);
+    for (size_t i = 0; i < size; i++)
+    {
+      result[i] = "key_" + std::to_string(i * 2);
+    }
+    return result;
+  }
+
+  // heap usage is reported only where glibc provides mallinfo2, elsewhere the column stays 0
+  size_t heap_in_use()
+  {
+#ifdef RYCHKOV_HAS_MALLINFO2
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+  }
+
+  template< class K, size_t N >
+  void run_fanout(const std::vector< K >& keys, const std::vector< K >& probes)
+  {
+    size_t size = keys.size();
+    size_t checksum = 0;
+    size_t bytes_before = heap_in_use();
+    rychkov::Map< K, int, std::less<>, N > map;
+    double insert_ns = measure_ns(size, [&]()
+        {
+          for (const K& key: keys)
+          {
+            map.emplace(key, 0);
+          }
+        });
+    double bytes = static_cast< double >(heap_in_use() - bytes_before) / size;
+    double find_ns = measure_ns(size, [&]()
+        {
+          for (const K& key: keys)
+          {
+            checksum += map.find(key) != map.end();
+          }
+        });
+    double lower_bound_ns = measure_ns(probes.size(), [&]()
+        {
+          for (const K& key: probes)
+          {
+            checksum += map.lower_bound(key) != map.end();
+          }
+        });
+    double lnr_ns = measure_ns(size, [&]()
+        {
+          map.traverse_lnr([&checksum](const typename decltype(map)::value_type& value)
+              {
+                checksum += value.second;
+              });
+        });
+    double breadth_ns = measure_ns(size, [&]()
+        {
+          map.traverse_breadth([&checksum](const typename decltype(map)::value_type& value)
+              {
+                checksum += value.second;
+              });
+        });
+    double erase_ns = measure_ns(size, [&]()
+        {
+          for (const K& key: keys)
+          {
+            checksum += map.erase(key);
+          }
+        });
+    std::cout << N << '\t' << size << '\t' << insert_ns << '\t' << find_ns << '\t' << lower_bound_ns
+        << '\t' << erase_ns << '\t' << lnr_ns << '\t' << breadth_ns << '\t' << bytes << '\n';
+    BOOST_TEST(map.empty());
+    BOOST_TEST(checksum >= size * 2);
+  }
+
+  struct generic_less
+  {
+    bool operator()(int lhs, int rhs) const noexcept
+    {
+      return lhs < rhs;
+    }
+  };
+
+  template< size_t N >
+  void run_key_search(const std::vector< int >& keys, const std::vector< int >& probes)
+  {
+    rychkov::Map< int, int, std::less<>, N > fast;
+    rychkov::Map< int, int, generic_less, N > generic;
+    for (int key: keys)
+    {
+      fast.emplace(key, key);
+      generic.emplace(key, key);
+    }
+    size_t checksum = 0;
+    double fast_find_ns = measure_ns(keys.size(), [&]()
+        {
+          for (int key: keys)
+          {
+            checksum += fast.find(key)->second == key;
+          }
+        });
+    double generic_find_ns = measure_ns(keys.size(), [&]()
+        {
+          for (int key: keys)
+          {
+            checksum += generic.find(key)->second == key;
+          }
+        });
+    double fast_lower_bound_ns = measure_ns(probes.size(), [&]()
+        {
+          for (int key: probes)
+          {
+            checksum += fast.lower_bound(key) != fast.end();
+          }
+        });
+    double generic_lower_bound_ns = measure_ns(probes.size(), [&]()
+        {
+          for (int key: probes)
+          {
+            checksum -= generic.lower_bound(key) != generic.end();
+          }
+        });
+    std::cout << N << '\t' << keys.size() << '\t' << generic_find_ns << '\t' << fast_find_ns
+        << '\t' << generic_lower_bound_ns << '\t' << fast_lower_bound_ns << '\n';
+    BOOST_TEST(checksum == keys.size() * 2);
+  }
+
+  template< class K, size_t... Ns >
+  void run_matrix(const char* name)
+  {
+    std::cout << name << '\n' << "N\tsize\tinsert\tfind\tlower_bound\terase\tlnr\tbreadth\tbytes/elem\n";
+    std::mt19937 engine(1);
+    for (size_t size = 1000; size <= 10000000; size *= 10)
+    {
+      std::vector< K > keys = generate_keys(size, K{});
+      std::vector< K > probes = generate_keys(size * 2, K{});
+      std::shuffle(keys.begin(), keys.end(), engine);
+      std::shuffle(probes.begin(), probes.end(), engine);
+      probes.resize(size);
+      std::initializer_list< int >{(run_fanout< K, Ns >(keys, probes), 0)...};
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(S4_map_benchmark, *boost::unit_test::disabled())
+
+BOOST_AUTO_TEST_CASE(fanout_int_keys)
+{
+  run_matrix< int, 2, 3, 4, 8, 16, 32, 64 >("int keys, ns/op");
+}
+BOOST_AUTO_TEST_CASE(fanout_string_keys)
+{
+  run_matrix< std::string, 2, 3, 4, 8, 16, 32, 64 >("std::string keys, ns/op");
+}
+
+BOOST_AUTO_TEST_CASE(int_key_search)
+{
+  std::cout << "int key search, ns/op\nN\tsize\tgeneric find\tfast find\tgeneric lower_bound\tfast lower_bound\n";
+  std::mt19937 engine(1);
+  for (size_t size = 1000; size <= 10000000; size *= 10)
+  {
+    std::vector< int > keys = generate_keys(size, int{});
+    std::vector< int > probes = generate_keys(size * 2, int{});
+    std::shuffle(keys.begin(), keys.end(), engine);
+    std::shuffle(probes.begin(), probes.end(), engine);
+    probes.resize(size);
+    std::initializer_list< int >{(run_key_search< 16 >(keys, probes), 0), (run_key_search< 32 >(keys, probes), 0),
+          (run_key_search< 64 >(keys, probes), 0)};
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
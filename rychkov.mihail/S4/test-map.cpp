@@ -4,6 +4,7 @@
 #include <chrono>
 #include <algorithm>
 #include <iterator>
+#include <map>
 #include <boost/test/unit_test.hpp>
 #include <mem_checker.hpp>
 #include <map.hpp>
@@ -13,7 +14,7 @@ BOOST_AUTO_TEST_SUITE(S4_map_test)
 
 BOOST_AUTO_TEST_CASE(multimap_test)
 {
-  rychkov::MultiMap< int, char > map = {{0, '1'}, {0, '2'}, {0, '3'}, {1, '3'}, {1, '4'}, {1, '4'}, {2, '5'}};
+  rychkov::MultiMap< int, char, std::less<>, 2 > map = {{0, '1'}, {0, '2'}, {0, '3'}, {1, '3'}, {1, '4'}, {1, '4'}, {2, '5'}};
   BOOST_TEST(map.size() == 7);
   BOOST_TEST((map.lower_bound(0) == map.begin()));
   BOOST_TEST(std::distance(map.upper_bound(0), --map.end()) == 3);
@@ -30,7 +31,7 @@ BOOST_AUTO_TEST_CASE(empty_test)
 }
 BOOST_AUTO_TEST_CASE(map_test)
 {
-  rychkov::Map< int, char > map = {{0, '1'}, {3, '2'}, {-1, '3'}, {2, '4'}, {3, '5'}, {9, '6'}};
+  rychkov::Map< int, char, std::less<>, 2 > map = {{0, '1'}, {3, '2'}, {-1, '3'}, {2, '4'}, {3, '5'}, {9, '6'}};
   BOOST_TEST(map.size() == 5);
   BOOST_TEST((map.find(234) == map.end()));
   BOOST_TEST((map.find(-1) == map.begin()));
@@ -50,7 +51,7 @@ BOOST_AUTO_TEST_CASE(map_test)
 }
 BOOST_AUTO_TEST_CASE(erase_test)
 {
-  rychkov::Set< int > set = {0, 2, 1, 5, -3, 4, -2};
+  rychkov::Set< int, std::less<>, 2 > set = {0, 2, 1, 5, -3, 4, -2};
   BOOST_TEST(*set.erase(set.find(0)) == 1);
   BOOST_TEST(set.erase(2) == 1);
   BOOST_TEST(set.erase(-1) == 0);
@@ -100,5 +101,43 @@ BOOST_AUTO_TEST_CASE(random_test)
     BOOST_TEST(set.size() == size);
   }
 }
+BOOST_AUTO_TEST_CASE(arithmetic_key_search_test)
+{
+  std::mt19937 engine(7);
+  std::uniform_int_distribution< int > range(-500, 500);
+  rychkov::MultiMap< int, int, std::greater<>, 16 > map;
+  rychkov::Map< int, int, std::less< int >, 32 > unique_map;
+  rychkov::Set< double, std::less<>, 64 > set;
+  std::multimap< int, int, std::greater<> > expected;
+  for (int i = 0; i < 4000; i++)
+  {
+    int key = range(engine);
+    map.emplace(key, i);
+    unique_map.emplace(key, i);
+    set.insert(key / 2.0);
+    expected.emplace(key, i);
+    if (i % 3 == 0)
+    {
+      int erased = range(engine);
+      map.erase(erased);
+      unique_map.erase(erased);
+      set.erase(erased / 2.0);
+      expected.erase(erased);
+    }
+  }
+  BOOST_TEST(map.size() == expected.size());
+  for (int key = -510; key <= 510; key++)
+  {
+    BOOST_TEST(std::distance(map.begin(), map.lower_bound(key))
+        == std::distance(expected.begin(), expected.lower_bound(key)));
+    BOOST_TEST(std::distance(map.begin(), map.upper_bound(key))
+        == std::distance(expected.begin(), expected.upper_bound(key)));
+    BOOST_TEST(map.count(key) == expected.count(key));
+    BOOST_TEST(unique_map.contains(key) == (expected.count(key) != 0));
+    BOOST_TEST(set.contains(key / 2.0) == (expected.count(key) != 0));
+    decltype(unique_map)::iterator found = unique_map.find(key);
+    BOOST_TEST(((found == unique_map.end()) || (found->first == key)));
+  }
+}
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -18,7 +18,7 @@ int main(int argc, char** argv)
     std::cerr << "failed to open file \"" << argv[2] << "\"\n";
     return 1;
   }
-  rychkov::Map< int, std::string > map;
+  rychkov::Map< int, std::string, std::less<>, 2 > map;
   int key = 0;
   std::string str;
   while (file >> key >> str)
@@ -7,7 +7,7 @@ BOOST_AUTO_TEST_SUITE(S5_traverse_test)
 
 BOOST_AUTO_TEST_CASE(iterator_test)
 {
-  rychkov::Set< int > set = {2, 5, 3, 0, 7, 9, 6, 10};
+  rychkov::Set< int, std::less<>, 2 > set = {2, 5, 3, 0, 7, 9, 6, 10};
   using heavy = decltype(set)::heavy_iterator;
   using rheavy = decltype(set)::reverse_heavy_iterator;
   BOOST_TEST(std::equal(set.begin(), set.end(), heavy{set.begin()}));
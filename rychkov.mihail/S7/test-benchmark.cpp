@@ -0,0 +1,50 @@
+#include <vector>
+#include <chrono>
+#include <iostream>
+#include <algorithm>
+#include <boost/test/unit_test.hpp>
+#include <unordered_map.hpp>
+
+namespace
+{
+  using clock = std::chrono::steady_clock;
+
+  double percentile(const std::vector< double >& sorted, double part)
+  {
+    return sorted[static_cast< size_t >(part * (sorted.size() - 1))];
+  }
+
+  void run_insert_latency(size_t size, bool incremental)
+  {
+    rychkov::UnorderedMap< size_t, size_t > map;
+    map.incremental_rehash(incremental);
+    std::vector< double > latencies(size);
+    clock::time_point total_start = clock::now();
+    for (size_t i = 0; i < size; i++)
+    {
+      clock::time_point start = clock::now();
+      map.emplace(i * 7919, i);
+      std::chrono::duration< double, std::nano > elapsed = clock::now() - start;
+      latencies[i] = elapsed.count();
+    }
+    std::chrono::duration< double, std::milli > total = clock::now() - total_start;
+    std::sort(latencies.begin(), latencies.end());
+    std::cout << (incremental ? "incremental" : "full") << '\t' << size << '\t' << percentile(latencies, 0.5)
+        << '\t' << percentile(latencies, 0.99) << '\t' << latencies.back() << '\t' << total.count() << '\n';
+    BOOST_TEST(map.size() == size);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(S7_unordered_map_benchmark, *boost::unit_test::disabled())
+
+BOOST_AUTO_TEST_CASE(insert_latency)
+{
+  std::cout << "insert latency, ns\nrehash\tsize\tp50\tp99\tmax\ttotal ms\n";
+  for (size_t size = 100000; size <= 10000000; size *= 10)
+  {
+    run_insert_latency(size, false);
+    run_insert_latency(size, true);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
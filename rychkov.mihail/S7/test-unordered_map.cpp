@@ -1,5 +1,7 @@
 #include <stdexcept>
 #include <iterator>
+#include <random>
+#include <unordered_map>
 #include <boost/test/unit_test.hpp>
 #include <mem_checker.hpp>
 #include <unordered_map.hpp>
@@ -130,5 +132,85 @@ BOOST_AUTO_TEST_CASE(traverse_stability_test)
     BOOST_TEST(counts[i] == 1);
   }
 }
+BOOST_AUTO_TEST_CASE(incremental_rehash_test)
+{
+  struct Wrapper
+  {
+    int value;
+    Wrapper(int v):
+      value(v)
+    {}
+  };
+
+  rychkov::MemTrack< Wrapper > observer{};
+  rychkov::UnorderedMultiMap< int, rychkov::MemChecker< Wrapper > > map;
+  std::unordered_multimap< int, int > expected;
+  map.incremental_rehash(true);
+  BOOST_TEST(map.incremental_rehash());
+  std::mt19937 engine(3);
+  std::uniform_int_distribution< int > keys(0, 3000);
+  for (int i = 0; i < 20000; i++)
+  {
+    int key = keys(engine);
+    switch (engine() % 4)
+    {
+    case 0:
+      BOOST_TEST(map.erase(key) == expected.erase(key));
+      break;
+    case 1:
+      BOOST_TEST(map.count(key) == expected.count(key));
+      break;
+    default:
+      map.emplace(key, i);
+      expected.emplace(key, i);
+    }
+    BOOST_TEST(map.size() == expected.size());
+  }
+  const rychkov::UnorderedMultiMap< int, rychkov::MemChecker< Wrapper > >& const_map = map;
+  BOOST_TEST(std::distance(const_map.begin(), const_map.end()) == expected.size());
+  for (const std::pair< const int, int >& i: expected)
+  {
+    BOOST_TEST(map.count(i.first) == expected.count(i.first));
+  }
+  rychkov::UnorderedMultiMap< int, rychkov::MemChecker< Wrapper > > copy = map;
+  BOOST_TEST(copy.size() == map.size());
+  map.clear();
+}
+
+BOOST_AUTO_TEST_CASE(incremental_rehash_pending_test)
+{
+  rychkov::UnorderedSet< int > set;
+  set.incremental_rehash(true);
+  int size = 0;
+  for (size_t buckets = set.bucket_count(); (size < 64) || (set.bucket_count() == buckets); size++)
+  {
+    buckets = set.bucket_count();
+    set.insert(size);
+  }
+  const rychkov::UnorderedSet< int >& const_set = set;
+  BOOST_TEST(std::distance(const_set.begin(), const_set.end()) == size);
+  BOOST_TEST(std::distance(set.begin(), set.end()) == size);
+  int sum = 0;
+  for (rychkov::UnorderedSet< int >::const_iterator i = const_set.end(); i != const_set.begin();)
+  {
+    sum += *--i;
+  }
+  BOOST_TEST(sum == size * (size - 1) / 2);
+  for (int i = 0; i < size; i++)
+  {
+    BOOST_TEST((const_set.find(i) != const_set.end() && *const_set.find(i) == i));
+    BOOST_TEST(const_set.count(i) == 1);
+  }
+  BOOST_TEST(std::distance(const_set.begin(), const_set.end()) == size);
+  int first = *set.begin();
+  set.erase(set.begin());
+  BOOST_TEST(!set.contains(first));
+  BOOST_TEST(std::distance(set.begin(), set.end()) == size - 1);
+  set.insert(size);
+  for (int i = 0; i <= size; i++)
+  {
+    BOOST_TEST(set.contains(i) == (i != first));
+  }
+}
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -6,9 +6,9 @@
 
 namespace rychkov
 {
-  template< class K, class T, class C = std::less<>, size_t N = 2 >
+  template< class K, class T, class C = std::less<>, size_t N = default_node_capacity_v< K > >
   using Map = MapBase< K, T, C, N, false, false >;
-  template< class K, class T, class C = std::less<>, size_t N = 2 >
+  template< class K, class T, class C = std::less<>, size_t N = default_node_capacity_v< K > >
   using MultiMap = MapBase< K, T, C, N, false, true >;
 }
 
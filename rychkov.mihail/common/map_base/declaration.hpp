@@ -3,6 +3,7 @@
 
 #include <utility>
 #include <memory>
+#include <functional>
 #include <type_traits.hpp>
 #include "node.hpp"
 #include "iterator.hpp"
@@ -25,6 +26,11 @@ namespace rychkov
   }
   namespace details
   {
+    template< class C, class K >
+    struct is_builtin_order: std::integral_constant< bool, std::is_same< C, std::less<> >::value
+          || std::is_same< C, std::less< K > >::value || std::is_same< C, std::greater<> >::value
+          || std::is_same< C, std::greater< K > >::value >
+    {};
     template< class R, class K1, class C, class... Exclude >
     using transparent_compare_key_t = std::enable_if_t< conjunction_v< !std::is_same< remove_cvref_t< K1 >,
               Exclude >::value... > && is_transparent_v< C >, R >;
@@ -39,6 +45,8 @@ namespace rychkov
     using key_compare = C;
   private:
     using real_value_type = std::conditional_t< IsSet, key_type, std::pair< key_type, mapped_type > >;
+    using node_type = MapBaseNode< real_value_type, N,
+          std::is_arithmetic< key_type >::value && details::is_builtin_order< key_compare, key_type >::value >;
   public:
     using value_type = std::conditional_t< IsSet, key_type, std::pair< const key_type, mapped_type > >;
     using size_type = size_t;
@@ -49,20 +57,20 @@ namespace rychkov
     using pointer = value_type*;
     using const_pointer = const value_type*;
 
-    using iterator = MapBaseIterator< value_type, N, real_value_type, false, false >;
-    using const_iterator = MapBaseIterator< value_type, N, real_value_type, true, false >;
-    using reverse_iterator = MapBaseIterator< value_type, N, real_value_type, false, true >;
-    using const_reverse_iterator = MapBaseIterator< value_type, N, real_value_type, true, true >;
+    using iterator = MapBaseIterator< value_type, N, node_type, false, false >;
+    using const_iterator = MapBaseIterator< value_type, N, node_type, true, false >;
+    using reverse_iterator = MapBaseIterator< value_type, N, node_type, false, true >;
+    using const_reverse_iterator = MapBaseIterator< value_type, N, node_type, true, true >;
 
-    using heavy_iterator = MapBaseHeavyIterator< value_type, N, real_value_type, false, false, false >;
-    using const_heavy_iterator = MapBaseHeavyIterator< value_type, N, real_value_type, true, false, false >;
-    using reverse_heavy_iterator = MapBaseHeavyIterator< value_type, N, real_value_type, false, true, false >;
-    using const_reverse_heavy_iterator = MapBaseHeavyIterator< value_type, N, real_value_type, true, true, false >;
+    using heavy_iterator = MapBaseHeavyIterator< value_type, N, node_type, false, false, false >;
+    using const_heavy_iterator = MapBaseHeavyIterator< value_type, N, node_type, true, false, false >;
+    using reverse_heavy_iterator = MapBaseHeavyIterator< value_type, N, node_type, false, true, false >;
+    using const_reverse_heavy_iterator = MapBaseHeavyIterator< value_type, N, node_type, true, true, false >;
 
-    using breadth_iterator = MapBaseHeavyIterator< value_type, N, real_value_type, false, false, true >;
-    using const_breadth_iterator = MapBaseHeavyIterator< value_type, N, real_value_type, true, false, true >;
-    using reverse_breadth_iterator = MapBaseHeavyIterator< value_type, N, real_value_type, false, true, true >;
-    using const_reverse_breadth_iterator = MapBaseHeavyIterator< value_type, N, real_value_type, true, true, true >;
+    using breadth_iterator = MapBaseHeavyIterator< value_type, N, node_type, false, false, true >;
+    using const_breadth_iterator = MapBaseHeavyIterator< value_type, N, node_type, true, false, true >;
+    using reverse_breadth_iterator = MapBaseHeavyIterator< value_type, N, node_type, false, true, true >;
+    using const_reverse_breadth_iterator = MapBaseHeavyIterator< value_type, N, node_type, true, true, true >;
 
     struct map_value_compare
     {
@@ -223,7 +231,6 @@ namespace rychkov
   private:
     static constexpr size_t node_capacity = N;
     static constexpr size_t node_middle = (node_capacity + 1) / 2;
-    using node_type = MapBaseNode< real_value_type, node_capacity >;
     using node_size_type = typename node_type::size_type;
 
     value_compare comp_;
@@ -241,6 +248,27 @@ namespace rychkov
         node_size_type ins_point, const_iterator& hint);
     static void correct_erase_result(const_iterator to, const_iterator from, iterator& result, bool will_be_replaced);
 
+    template< class K1 >
+    using key_search_t = std::integral_constant< bool, std::is_same< K1, key_type >::value
+          && node_type::has_contiguous_keys >;
+    template< class K1 >
+    node_size_type count_less(const node_type& node, const K1& key) const;
+    template< class K1 >
+    node_size_type count_less(const node_type& node, const K1& key, std::true_type) const;
+    template< class K1 >
+    node_size_type count_less(const node_type& node, const K1& key, std::false_type) const;
+    template< class K1 >
+    node_size_type count_not_greater(const node_type& node, const K1& key) const;
+    template< class K1 >
+    node_size_type count_not_greater(const node_type& node, const K1& key, std::true_type) const;
+    template< class K1 >
+    node_size_type count_not_greater(const node_type& node, const K1& key, std::false_type) const;
+    template< class K1 >
+    bool key_less_at(const K1& key, const node_type& node, node_size_type i) const;
+    template< class K1 >
+    bool key_less_at(const K1& key, const node_type& node, node_size_type i, std::true_type) const;
+    template< class K1 >
+    bool key_less_at(const K1& key, const node_type& node, node_size_type i, std::false_type) const;
     template< class K1 >
     std::pair< const_iterator, const_iterator > lower_bound_impl(const K1& key) const;
     template< class K1 >
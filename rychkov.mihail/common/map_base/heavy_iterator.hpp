@@ -10,18 +10,17 @@
 
 namespace rychkov
 {
-  template< class V, size_t N, class RealV, bool isConst, bool isReversed >
+  template< class V, size_t N, class NodeT, bool isConst, bool isReversed >
   class MapBaseIterator;
 
-  template< class Value, size_t N, class RealValue, bool isConst, bool isReversed, bool isBreadth >
+  template< class Value, size_t N, class Node, bool isConst, bool isReversed, bool isBreadth >
   class MapBaseHeavyIterator
   {
   private:
     static constexpr size_t node_capacity = N;
-    using real_value_type = RealValue;
-    using node_type = MapBaseNode< real_value_type, node_capacity >;
+    using node_type = Node;
 
-    template< class V, size_t N1, class RealV, bool isConst1, bool isReversed1 >
+    template< class V, size_t N1, class NodeT, bool isConst1, bool isReversed1 >
     friend class MapBaseIterator;
   public:
     using difference_type = ptrdiff_t;
@@ -37,11 +36,11 @@ namespace rychkov
     {}
     template< bool isConst1 = isConst >
     MapBaseHeavyIterator(typename std::enable_if_t< isConst && isConst1,
-          MapBaseHeavyIterator< Value, N, RealValue, false, isReversed, isBreadth > > rhs):
+          MapBaseHeavyIterator< Value, N, Node, false, isReversed, isBreadth > > rhs):
       container_(rhs.container_),
       pointed_(rhs.pointed_)
     {}
-    MapBaseHeavyIterator(MapBaseIterator< Value, N, RealValue, isConst, isReversed > src):
+    MapBaseHeavyIterator(MapBaseIterator< Value, N, Node, isConst, isReversed > src):
       MapBaseHeavyIterator()
     {
       if (isBreadth)
@@ -138,7 +137,7 @@ namespace rychkov
       return reinterpret_cast< value_type* >(std::addressof(top()->operator[](pointed_)));
     }
   private:
-    friend class MapBaseHeavyIterator< Value, N, RealValue, true, isReversed, isBreadth >;
+    friend class MapBaseHeavyIterator< Value, N, Node, true, isReversed, isBreadth >;
 
     using node_size_type = typename node_type::size_type;
     using container = std::conditional_t< isBreadth, Queue< node_type* >, Stack< node_type* > >;
@@ -160,8 +159,8 @@ namespace rychkov
   };
 }
 
-template< class Value, size_t N, class RealValue, bool isConst, bool isReversed, bool isBreadth >
-void rychkov::MapBaseHeavyIterator< Value, N, RealValue, isConst, isReversed, isBreadth >::shift_left()
+template< class Value, size_t N, class Node, bool isConst, bool isReversed, bool isBreadth >
+void rychkov::MapBaseHeavyIterator< Value, N, Node, isConst, isReversed, isBreadth >::shift_left()
 {
   if (isBreadth)
   {
@@ -215,8 +214,8 @@ void rychkov::MapBaseHeavyIterator< Value, N, RealValue, isConst, isReversed, is
     }
   }
 }
-template< class Value, size_t N, class RealValue, bool isConst, bool isReversed, bool isBreadth >
-void rychkov::MapBaseHeavyIterator< Value, N, RealValue, isConst, isReversed, isBreadth >::shift_right()
+template< class Value, size_t N, class Node, bool isConst, bool isReversed, bool isBreadth >
+void rychkov::MapBaseHeavyIterator< Value, N, Node, isConst, isReversed, isBreadth >::shift_right()
 {
   if (isBreadth)
   {
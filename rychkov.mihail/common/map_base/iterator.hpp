@@ -7,18 +7,17 @@
 
 namespace rychkov
 {
-  template< class V, size_t N, class RealV, bool isConst, bool isReversed, bool isBreadth >
+  template< class V, size_t N, class NodeT, bool isConst, bool isReversed, bool isBreadth >
   class MapBaseHeavyIterator;
 
-  template< class Value, size_t N, class RealValue, bool isConst, bool isReversed >
+  template< class Value, size_t N, class Node, bool isConst, bool isReversed >
   class MapBaseIterator
   {
   private:
     static constexpr size_t node_capacity = N;
-    using real_value_type = RealValue;
-    using node_type = MapBaseNode< real_value_type, node_capacity >;
+    using node_type = Node;
 
-    template< class V, size_t N1, class RealV, bool isConst1, bool isReversed1, bool isBreadth >
+    template< class V, size_t N1, class NodeT, bool isConst1, bool isReversed1, bool isBreadth >
     friend class MapBaseHeavyIterator;
   public:
     using difference_type = ptrdiff_t;
@@ -33,15 +32,15 @@ namespace rychkov
     {};
     template< bool isConst1 = isConst >
     MapBaseIterator(typename std::enable_if_t< isConst && isConst1,
-          MapBaseIterator< Value, N, RealValue, false, isReversed > > rhs) noexcept:
+          MapBaseIterator< Value, N, Node, false, isReversed > > rhs) noexcept:
       node_(rhs.node_),
       pointed_(rhs.pointed_)
     {}
-    MapBaseIterator(MapBaseHeavyIterator< Value, N, RealValue, isConst, isReversed, false > src) noexcept:
+    MapBaseIterator(MapBaseHeavyIterator< Value, N, Node, isConst, isReversed, false > src) noexcept:
       node_(src.container_.empty() ? nullptr : src.top()),
       pointed_(src.pointed_)
     {}
-    MapBaseIterator(MapBaseHeavyIterator< Value, N, RealValue, isConst, isReversed, true > src) noexcept:
+    MapBaseIterator(MapBaseHeavyIterator< Value, N, Node, isConst, isReversed, true > src) noexcept:
       node_(src.container_.empty() ? nullptr : src.top()),
       pointed_(src.pointed_)
     {}
@@ -100,7 +99,7 @@ namespace rychkov
   private:
     template< class K, class M, class C, size_t N1, bool IsSet, bool IsMulti >
     friend class MapBase;
-    friend class MapBaseIterator< Value, N, RealValue, true, isReversed >;
+    friend class MapBaseIterator< Value, N, Node, true, isReversed >;
 
     using node_size_type = typename node_type::size_type;
     node_type* node_;
@@ -116,8 +115,8 @@ namespace rychkov
   };
 }
 
-template< class Value, size_t N, class RealValue, bool isConst, bool isReversed >
-void rychkov::MapBaseIterator< Value, N, RealValue, isConst, isReversed >::shift_left() noexcept
+template< class Value, size_t N, class Node, bool isConst, bool isReversed >
+void rychkov::MapBaseIterator< Value, N, Node, isConst, isReversed >::shift_left() noexcept
 {
   if (node_->isfake() || !node_->isleaf())
   {
@@ -150,8 +149,8 @@ void rychkov::MapBaseIterator< Value, N, RealValue, isConst, isReversed >::shift
     }
   }
 }
-template< class Value, size_t N, class RealValue, bool isConst, bool isReversed >
-void rychkov::MapBaseIterator< Value, N, RealValue, isConst, isReversed >::shift_right() noexcept
+template< class Value, size_t N, class Node, bool isConst, bool isReversed >
+void rychkov::MapBaseIterator< Value, N, Node, isConst, isReversed >::shift_right() noexcept
 {
   if (node_->isfake() || !node_->isleaf())
   {
@@ -180,8 +179,8 @@ void rychkov::MapBaseIterator< Value, N, RealValue, isConst, isReversed >::shift
     }
   }
 }
-template< class Value, size_t N, class RealValue, bool isConst, bool isReversed >
-void rychkov::MapBaseIterator< Value, N, RealValue, isConst, isReversed >::move_up() noexcept
+template< class Value, size_t N, class Node, bool isConst, bool isReversed >
+void rychkov::MapBaseIterator< Value, N, Node, isConst, isReversed >::move_up() noexcept
 {
   node_type* prev = node_;
   node_ = node_->parent;
@@ -4,17 +4,58 @@
 #include <cstddef>
 #include <utility>
 #include <memory>
+#include <type_traits>
 #include <type_tools.hpp>
 
 namespace rychkov
 {
-  template< class Value, size_t N >
+  namespace details
+  {
+    template< class Value >
+    struct node_key
+    {
+      using type = Value;
+      static const type& get(const Value& value) noexcept
+      {
+        return value;
+      }
+    };
+    template< class K, class T >
+    struct node_key< std::pair< K, T > >
+    {
+      using type = K;
+      static const type& get(const std::pair< K, T >& value) noexcept
+      {
+        return value.first;
+      }
+    };
+
+    template< class Key, size_t N >
+    struct node_key_block: std::integral_constant< size_t, (64 / sizeof(Key) < 1 ? 1
+          : (64 / sizeof(Key) > N ? N : 64 / sizeof(Key))) >
+    {};
+
+    template< class Key, size_t N, bool IsMirrored >
+    struct node_key_storage
+    {};
+    template< class Key, size_t N >
+    struct node_key_storage< Key, N, true >
+    {
+      static constexpr size_t block = node_key_block< Key, N >::value;
+      Key data[(N + block - 1) / block * block]{};
+    };
+  }
+
+  template< class Value, size_t N, bool IsMirrored >
   class MapBaseNode
   {
   public:
     using value_type = Value;
     using size_type = select_size_type_t< N >;
+    using key_type = typename details::node_key< Value >::type;
     static constexpr size_t node_capacity = N;
+    static constexpr bool has_contiguous_keys = IsMirrored;
+    static constexpr size_t key_block = details::node_key_block< key_type, N >::value;
 
     static_assert(N >= 2, "");
 
@@ -34,7 +75,7 @@ namespace rychkov
     }
     const value_type& operator[](size_type i) const
     {
-      return *(reinterpret_cast< value_type* >(data_) + i);
+      return *(reinterpret_cast< const value_type* >(data_) + i);
     }
     bool empty() const noexcept
     {
@@ -56,6 +97,11 @@ namespace rychkov
     {
       return children[0] == nullptr;
     }
+    const key_type* keys() const noexcept
+    {
+      static_assert(has_contiguous_keys, "node keys are not stored contiguously");
+      return keys_.data;
+    }
 
     template< class... Args >
     void emplace(size_type newPlace, Args&&... args)
@@ -77,6 +123,7 @@ namespace rychkov
         children[newPlace + 1] = nullptr;
       }
       size_++;
+      sync_keys(newPlace, size_);
     }
     template< class... Args >
     void emplace_back(Args&&... args)
@@ -88,6 +135,7 @@ namespace rychkov
     {
       operator[](i).~value_type();
       new(std::addressof(operator[](i))) value_type{std::forward< Args >(args)...};
+      sync_keys(i, i + 1);
     }
     void erase(size_type i)
     {
@@ -99,6 +147,7 @@ namespace rychkov
         children[j] = children[j + 1];
       }
       size_--;
+      sync_keys(i, size_);
     }
     void pop_back()
     {
@@ -107,6 +156,21 @@ namespace rychkov
   private:
     size_type size_ = 0;
     alignas(value_type) unsigned char data_[node_capacity * sizeof(value_type)];
+    details::node_key_storage< key_type, node_capacity, has_contiguous_keys > keys_;
+
+    void sync_keys(size_type from, size_type to) noexcept
+    {
+      sync_keys(from, to, std::integral_constant< bool, has_contiguous_keys >{});
+    }
+    void sync_keys(size_type from, size_type to, std::true_type) noexcept
+    {
+      for (size_type i = from; i < to; i++)
+      {
+        keys_.data[i] = details::node_key< Value >::get(operator[](i));
+      }
+    }
+    void sync_keys(size_type, size_type, std::false_type) noexcept
+    {}
   };
 }
 
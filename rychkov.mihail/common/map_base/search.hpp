@@ -47,6 +47,119 @@ const typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::key_type&
   return key;
 }
 
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K1 >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::node_size_type
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::count_less(const node_type& node, const K1& key) const
+{
+  return count_less(node, key, key_search_t< K1 >{});
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K1 >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::node_size_type
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::count_less(const node_type& node, const K1& key,
+    std::true_type) const
+{
+  constexpr unsigned block = node_type::key_block;
+  const key_type* keys = node.keys();
+  unsigned size = node.size();
+  unsigned result = 0;
+  for (unsigned from = 0; from < size; from += block)
+  {
+    unsigned matched = 0;
+    for (unsigned i = 0; i < block; i++)
+    {
+      matched += compare_with_key(keys[from + i], key) & (from + i < size);
+    }
+    result += matched;
+    if (matched != block)
+    {
+      break;
+    }
+  }
+  return result;
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K1 >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::node_size_type
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::count_less(const node_type& node, const K1& key,
+    std::false_type) const
+{
+  node_size_type result = 0;
+  while ((result < node.size()) && compare_with_key(node[result], key))
+  {
+    result++;
+  }
+  return result;
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K1 >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::node_size_type
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::count_not_greater(const node_type& node, const K1& key) const
+{
+  return count_not_greater(node, key, key_search_t< K1 >{});
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K1 >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::node_size_type
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::count_not_greater(const node_type& node, const K1& key,
+    std::true_type) const
+{
+  constexpr unsigned block = node_type::key_block;
+  const key_type* keys = node.keys();
+  unsigned size = node.size();
+  unsigned result = 0;
+  for (unsigned from = 0; from < size; from += block)
+  {
+    unsigned matched = 0;
+    for (unsigned i = 0; i < block; i++)
+    {
+      matched += !compare_with_key(key, keys[from + i]) & (from + i < size);
+    }
+    result += matched;
+    if (matched != block)
+    {
+      break;
+    }
+  }
+  return result;
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K1 >
+typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::node_size_type
+    rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::count_not_greater(const node_type& node, const K1& key,
+    std::false_type) const
+{
+  node_size_type result = 0;
+  while ((result < node.size()) && !compare_with_key(key, node[result]))
+  {
+    result++;
+  }
+  return result;
+}
+
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K1 >
+bool rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::key_less_at(const K1& key, const node_type& node,
+    node_size_type i) const
+{
+  return key_less_at(key, node, i, key_search_t< K1 >{});
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K1 >
+bool rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::key_less_at(const K1& key, const node_type& node,
+    node_size_type i, std::true_type) const
+{
+  return compare_with_key(key, node.keys()[i]);
+}
+template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
+template< class K1 >
+bool rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::key_less_at(const K1& key, const node_type& node,
+    node_size_type i, std::false_type) const
+{
+  return compare_with_key(key, node[i]);
+}
+
 template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
 template< class K1 >
 std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator,
@@ -57,44 +170,29 @@ std::pair< typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterat
   {
     return {end(), end()};
   }
-  const_iterator left = {fake_children_[0], 0}, right = end();
+  node_type* node = fake_children_[0];
+  const_iterator right = end();
   while (true)
   {
-    if (compare_with_key(key, *left))
+    node_size_type i = count_less(*node, key);
+    if (i < node->size())
     {
-      right = left;
-      if (left.node_->isleaf())
+      const_iterator current = {node, i};
+      if (!IsMulti && !key_less_at(key, *node, i))
       {
-        return {left, left};
+        return {current, current};
       }
-      left = {left.node_->children[left.pointed_], 0};
-    }
-    else if (!compare_with_key(*left, key))
-    {
-      if (IsMulti)
+      right = current;
+      if (node->isleaf())
       {
-        right = left;
-        if (left.node_->isleaf())
-        {
-          return {left, left};
-        }
-        left = {left.node_->children[left.pointed_], 0};
-        continue;
+        return {current, current};
       }
-      return {left, left};
     }
-    else
+    else if (node->isleaf())
     {
-      left.pointed_++;
-      if (left.pointed_ >= left.node_->size())
-      {
-        if (left.node_->isleaf())
-        {
-          return {left, right};
-        }
-        left = {left.node_->children[left.pointed_], 0};
-      }
+      return {{node, i}, right};
     }
+    node = node->children[i];
   }
 }
 template< class K, class T, class C, size_t N, bool IsSet, bool IsMulti >
@@ -106,30 +204,20 @@ typename rychkov::MapBase< K, T, C, N, IsSet, IsMulti >::const_iterator
   {
     return end();
   }
-  const_iterator left = {fake_children_[0], 0}, right = end();
+  node_type* node = fake_children_[0];
+  const_iterator right = end();
   while (true)
   {
-    node_size_type i = 0;
-    while (i < left.node_->size())
+    node_size_type i = count_not_greater(*node, key);
+    if (i < node->size())
     {
-      if (compare_with_key(key, left.node_->operator[](i)))
-      {
-        right = {left.node_, i};
-        if (left.node_->isleaf())
-        {
-          return right;
-        }
-        left = {left.node_->children[i], 0};
-        i = 0;
-        continue;
-      }
-      i++;
+      right = {node, i};
     }
-    if (left.node_->isleaf())
+    if (node->isleaf())
     {
       return right;
     }
-    left = {left.node_->children[i], 0};
+    node = node->children[i];
   }
 }
 
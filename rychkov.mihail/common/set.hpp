@@ -6,9 +6,9 @@
 
 namespace rychkov
 {
-  template< class K, class C = std::less<>, size_t N = 2 >
+  template< class K, class C = std::less<>, size_t N = default_node_capacity_v< K > >
   using Set = MapBase< K, K, C, N, true, false >;
-  template< class K, class C = std::less<>, size_t N = 2 >
+  template< class K, class C = std::less<>, size_t N = default_node_capacity_v< K > >
   using MultiSet = MapBase< K, K, C, N, true, true >;
 }
 
@@ -0,0 +1,184 @@
+#ifndef SPSC_QUEUE_HPP
+#define SPSC_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <thread>
+#include <utility>
+
+namespace rychkov
+{
+  template< class T >
+  class SpscQueue
+  {
+  public:
+    using value_type = T;
+    using size_type = size_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    static constexpr size_type cache_line = 64;
+
+    explicit SpscQueue(size_type minCapacity = 1024);
+    SpscQueue(const SpscQueue&) = delete;
+    ~SpscQueue();
+
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+    size_type capacity() const noexcept;
+
+    reference front() noexcept;
+    const_reference front() const noexcept;
+
+    template< class... Args >
+    bool try_emplace(Args&&... args);
+    bool try_push(const value_type& value);
+    bool try_push(value_type&& value);
+    template< class... Args >
+    void emplace(Args&&... args);
+    void push(const value_type& value);
+    void push(value_type&& value);
+    void pop() noexcept;
+  private:
+    alignas(cache_line) std::atomic< size_type > head_;
+    mutable size_type cachedTail_;
+    alignas(cache_line) std::atomic< size_type > tail_;
+    size_type cachedHead_;
+    alignas(cache_line) size_type mask_;
+    value_type* data_;
+
+    static size_type roundCapacity(size_type minCapacity) noexcept;
+  };
+}
+
+template< class T >
+constexpr typename rychkov::SpscQueue< T >::size_type rychkov::SpscQueue< T >::cache_line;
+
+template< class T >
+rychkov::SpscQueue< T >::SpscQueue(size_type minCapacity):
+  head_(0),
+  cachedTail_(0),
+  tail_(0),
+  cachedHead_(0),
+  mask_(roundCapacity(minCapacity) - 1),
+  data_(static_cast< value_type* >(::operator new(sizeof(value_type) * (mask_ + 1))))
+{}
+template< class T >
+rychkov::SpscQueue< T >::~SpscQueue()
+{
+  while (!empty())
+  {
+    pop();
+  }
+  ::operator delete(data_);
+}
+
+template< class T >
+bool rychkov::SpscQueue< T >::empty() const noexcept
+{
+  size_type head = head_.load(std::memory_order_relaxed);
+  size_type available = cachedTail_ - head;
+  if ((available == 0) || (available > mask_ + 1))
+  {
+    cachedTail_ = tail_.load(std::memory_order_acquire);
+  }
+  return head == cachedTail_;
+}
+template< class T >
+typename rychkov::SpscQueue< T >::size_type rychkov::SpscQueue< T >::size() const noexcept
+{
+  return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+}
+template< class T >
+typename rychkov::SpscQueue< T >::size_type rychkov::SpscQueue< T >::capacity() const noexcept
+{
+  return mask_ + 1;
+}
+
+template< class T >
+typename rychkov::SpscQueue< T >::reference rychkov::SpscQueue< T >::front() noexcept
+{
+  return data_[head_.load(std::memory_order_relaxed) & mask_];
+}
+template< class T >
+typename rychkov::SpscQueue< T >::const_reference rychkov::SpscQueue< T >::front() const noexcept
+{
+  return data_[head_.load(std::memory_order_relaxed) & mask_];
+}
+
+template< class T >
+template< class... Args >
+bool rychkov::SpscQueue< T >::try_emplace(Args&&... args)
+{
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  if (tail - cachedHead_ > mask_)
+  {
+    cachedHead_ = head_.load(std::memory_order_acquire);
+    if (tail - cachedHead_ > mask_)
+    {
+      return false;
+    }
+  }
+  new (data_ + (tail & mask_)) value_type(std::forward< Args >(args)...);
+  tail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+template< class T >
+bool rychkov::SpscQueue< T >::try_push(const value_type& value)
+{
+  return try_emplace(value);
+}
+template< class T >
+bool rychkov::SpscQueue< T >::try_push(value_type&& value)
+{
+  return try_emplace(std::move(value));
+}
+template< class T >
+template< class... Args >
+void rychkov::SpscQueue< T >::emplace(Args&&... args)
+{
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  while (tail - cachedHead_ > mask_)
+  {
+    cachedHead_ = head_.load(std::memory_order_acquire);
+    if (tail - cachedHead_ > mask_)
+    {
+      std::this_thread::yield();
+    }
+  }
+  new (data_ + (tail & mask_)) value_type(std::forward< Args >(args)...);
+  tail_.store(tail + 1, std::memory_order_release);
+}
+template< class T >
+void rychkov::SpscQueue< T >::push(const value_type& value)
+{
+  emplace(value);
+}
+template< class T >
+void rychkov::SpscQueue< T >::push(value_type&& value)
+{
+  emplace(std::move(value));
+}
+template< class T >
+void rychkov::SpscQueue< T >::pop() noexcept
+{
+  size_type head = head_.load(std::memory_order_relaxed);
+  data_[head & mask_].~value_type();
+  head_.store(head + 1, std::memory_order_release);
+}
+
+template< class T >
+typename rychkov::SpscQueue< T >::size_type rychkov::SpscQueue< T >::roundCapacity(size_type minCapacity) noexcept
+{
+  size_type result = 1;
+  while (result < minCapacity)
+  {
+    result *= 2;
+  }
+  return result;
+}
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef TYPE_TRAITS_HPP
 #define TYPE_TRAITS_HPP
 
+#include <cstddef>
 #include <type_traits>
 
 namespace rychkov
@@ -35,6 +36,12 @@ namespace rychkov
   {};
   template< class Cmp >
   constexpr bool is_transparent_v = is_transparent< Cmp >::value;
+
+  template< class K >
+  struct default_node_capacity: std::integral_constant< size_t, (sizeof(K) <= sizeof(void*) ? 16 : 8) >
+  {};
+  template< class K >
+  constexpr size_t default_node_capacity_v = default_node_capacity< K >::value;
 }
 
 #endif
@@ -38,6 +38,17 @@ void rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::max_load_factor(float
   max_factor_ = new_factor;
 }
 
+template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
+bool rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::incremental_rehash() const noexcept
+{
+  return incremental_;
+}
+template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
+void rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::incremental_rehash(bool enabled) noexcept
+{
+  incremental_ = enabled;
+}
+
 template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
 typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::size_type
     rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::bucket_count() const noexcept
@@ -80,7 +91,7 @@ template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
 typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::iterator
     rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::begin() noexcept
 {
-  return {cached_begin_, data_ + capacity_};
+  return make_iterator(first_slot());
 }
 template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
 typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::const_iterator
@@ -92,14 +103,14 @@ template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
 typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::const_iterator
     rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::cbegin() const noexcept
 {
-  return {cached_begin_, data_ + capacity_};
+  return make_iterator(first_slot());
 }
 
 template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
 typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::iterator
     rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::end() noexcept
 {
-  return {data_ + capacity_, data_ + capacity_};
+  return make_iterator(data_ + capacity_);
 }
 template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
 typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::const_iterator
@@ -111,7 +122,7 @@ template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
 typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::const_iterator
     rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::cend() const noexcept
 {
-  return {data_ + capacity_, data_ + capacity_};
+  return make_iterator(data_ + capacity_);
 }
 
 #endif
@@ -11,20 +11,32 @@ rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::UnorderedBase()
   capacity_{0},
   size_{0},
   max_factor_{default_max_factor},
+  incremental_{false},
   data_{nullptr},
   raw_{nullptr},
-  cached_begin_{nullptr}
+  cached_begin_{nullptr},
+  old_capacity_{0},
+  old_size_{0},
+  migrated_{0},
+  old_data_{nullptr},
+  old_raw_{nullptr}
 {}
 template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
 rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::UnorderedBase(size_type cnt, hasher hash, key_equal eq):
   capacity_{0},
   size_{0},
   max_factor_{default_max_factor},
+  incremental_{false},
   data_{nullptr},
   raw_{nullptr},
   cached_begin_{nullptr},
   hash_{std::move(hash)},
-  equal_{std::move(eq)}
+  equal_{std::move(eq)},
+  old_capacity_{0},
+  old_size_{0},
+  migrated_{0},
+  old_data_{nullptr},
+  old_raw_{nullptr}
 {
   allocate(cnt);
 }
@@ -33,11 +45,17 @@ rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::UnorderedBase(UnorderedBas
   capacity_{std::exchange(rhs.capacity_, 0)},
   size_{std::exchange(rhs.size_, 0)},
   max_factor_{std::exchange(rhs.max_factor_, default_max_factor + 0)},
+  incremental_{std::exchange(rhs.incremental_, false)},
   data_{std::exchange(rhs.data_, nullptr)},
   raw_{std::exchange(rhs.raw_, nullptr)},
   cached_begin_{std::exchange(rhs.cached_begin_, nullptr)},
   hash_{std::move(rhs.hash_)},
-  equal_{std::move(rhs.equal_)}
+  equal_{std::move(rhs.equal_)},
+  old_capacity_{std::exchange(rhs.old_capacity_, 0)},
+  old_size_{std::exchange(rhs.old_size_, 0)},
+  migrated_{std::exchange(rhs.migrated_, 0)},
+  old_data_{std::exchange(rhs.old_data_, nullptr)},
+  old_raw_{std::exchange(rhs.old_raw_, nullptr)}
 {}
 template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
 rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::UnorderedBase(const UnorderedBase& rhs):
@@ -112,13 +130,27 @@ void rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::swap(UnorderedBase& r
   std::swap(capacity_, rhs.capacity_);
   std::swap(size_, rhs.size_);
   std::swap(max_factor_, rhs.max_factor_);
+  std::swap(incremental_, rhs.incremental_);
   std::swap(data_, rhs.data_);
   std::swap(raw_, rhs.raw_);
   std::swap(cached_begin_, rhs.cached_begin_);
+  std::swap(old_capacity_, rhs.old_capacity_);
+  std::swap(old_size_, rhs.old_size_);
+  std::swap(migrated_, rhs.migrated_);
+  std::swap(old_data_, rhs.old_data_);
+  std::swap(old_raw_, rhs.old_raw_);
 }
 template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
 void rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::clear() noexcept
 {
+  for (size_type i = migrated_; i < old_capacity_; i++)
+  {
+    if (old_data_[i].first != ~0ULL)
+    {
+      old_data_[i].second.~value_type();
+    }
+  }
+  release_old();
   for (size_type i = 0; i < capacity_; i++)
   {
     if (data_[i].first == ~0ULL)
@@ -86,6 +86,8 @@ namespace rychkov
     float load_factor() const noexcept;
     float max_load_factor() const noexcept;
     void max_load_factor(float new_factor) noexcept;
+    bool incremental_rehash() const noexcept;
+    void incremental_rehash(bool enabled) noexcept;
 
     size_type bucket_count() const noexcept;
     size_type max_bucket_count() const noexcept;
@@ -192,25 +194,50 @@ namespace rychkov
     using temp_value = std::conditional_t< IsSet, key_type, std::pair< key_type, mapped_type > >;
     using temp_stored = std::pair< size_type, temp_value >;
     static constexpr float default_max_factor = 0.5;
+    static constexpr size_type rehash_step = 16;
 
     size_type capacity_, size_;
     float max_factor_;
+    bool incremental_;
     stored_value* data_;
     unsigned char* raw_;
     stored_value* cached_begin_;
     hasher hash_;
     key_equal equal_;
 
+    // table being drained by an incremental rehash; only insertions move elements out of it,
+    // lookups probe both arrays and iterators walk the old one first
+    size_type old_capacity_, old_size_, migrated_;
+    stored_value* old_data_;
+    unsigned char* old_raw_;
+
     void allocate(size_type new_capacity);
     bool extend(size_type new_capacity);
 
+    void start_rehash(size_type new_capacity);
+    void finish_rehash();
+    void migrate_buckets(size_type budget);
+    template< class K1 >
+    void migrate_key(const K1& key);
+    void migrate_slot(stored_value* pos);
+    void close_old_gap(stored_value* pos) noexcept;
+    void release_old() noexcept;
+    void place(temp_value&& value);
+    bool is_old(const stored_value* pos) const noexcept;
+    iterator make_iterator(stored_value* pos) const noexcept;
+    stored_value* first_slot() const noexcept;
+
     template< class K1 >
     size_type count_impl(const K1& key) const;
     template< class K1 >
-    const_iterator find_impl(const K1& key) const;
+    size_type count_impl(const K1& key, const stored_value* data, size_type capacity) const;
+    template< class K1 >
+    stored_value* find_impl(const K1& key) const;
+    template< class K1 >
+    stored_value* find_impl(const K1& key, stored_value* data, size_type capacity) const;
 
     template< class K1 >
-    std::pair< const_iterator, bool > find_hint_pair(const K1& key) const;
+    std::pair< const_iterator, bool > find_hint_pair(const K1& key);
     template< class K1 >
     std::pair< const_iterator, bool > correct_hint(const_iterator hint, const K1& key);
     template< class... Args >
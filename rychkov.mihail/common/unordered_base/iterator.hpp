@@ -19,13 +19,17 @@ namespace rychkov
 
     UnorderedBaseIterator() noexcept:
       data_(nullptr),
-      end_(nullptr)
+      end_(nullptr),
+      old_end_(nullptr),
+      new_begin_(nullptr)
     {};
     template< bool IsConst1 = IsConst >
     UnorderedBaseIterator(typename std::enable_if_t< IsConst && IsConst1,
           UnorderedBaseIterator< V, false > > rhs) noexcept:
       data_(rhs.data_),
-      end_(rhs.end_)
+      end_(rhs.end_),
+      old_end_(rhs.old_end_),
+      new_begin_(rhs.new_begin_)
     {}
 
     bool operator==(UnorderedBaseIterator rhs) const noexcept
@@ -89,22 +93,44 @@ namespace rychkov
 
     stored_value* data_;
     stored_value* end_;
+    // while an incremental rehash is pending the old array is walked first
+    // and its end is chained to the beginning of the new one
+    stored_value* old_end_;
+    stored_value* new_begin_;
 
-    UnorderedBaseIterator(stored_value* data, stored_value* end) noexcept:
+    UnorderedBaseIterator(stored_value* data, stored_value* end,
+          stored_value* old_end = nullptr, stored_value* new_begin = nullptr) noexcept:
       data_(data),
-      end_(end)
+      end_(end),
+      old_end_(old_end),
+      new_begin_(new_begin)
     {};
 
     void shift_left() noexcept
     {
-      for (--data_; data_->first == ~0ULL; --data_)
+      for (step_left(); data_->first == ~0ULL; step_left())
       {}
     }
     void shift_right() noexcept
     {
-      for (++data_; (data_ != end_) && (data_->first == ~0ULL); ++data_)
+      for (step_right(); (data_ != end_) && (data_->first == ~0ULL); step_right())
       {}
     }
+    void step_left() noexcept
+    {
+      if (data_ == new_begin_)
+      {
+        data_ = old_end_;
+      }
+      --data_;
+    }
+    void step_right() noexcept
+    {
+      if (++data_ == old_end_)
+      {
+        data_ = new_begin_;
+      }
+    }
   };
 }
 
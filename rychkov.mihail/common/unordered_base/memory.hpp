@@ -5,6 +5,7 @@
 
 #include <utility>
 #include <cmath>
+#include <functional>
 #include <memory>
 #include <type_traits.hpp>
 
@@ -36,7 +37,14 @@ bool rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::extend(size_type new_
   {
     return false;
   }
-  rehash(required_size * 2);
+  if (incremental_)
+  {
+    start_rehash(required_size * 2);
+  }
+  else
+  {
+    rehash(required_size * 2);
+  }
   return true;
 }
 template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
@@ -47,11 +55,13 @@ void rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::reserve(size_type new
 template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
 void rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::rehash(size_type cnt)
 {
+  finish_rehash();
   if (cnt <= capacity_)
   {
     return;
   }
   UnorderedBase temp{cnt, hash_, equal_};
+  temp.incremental_ = incremental_;
   for (size_type i = 0; i < capacity_; i++)
   {
     if (data_[i].first != ~0ULL)
@@ -62,6 +72,162 @@ void rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::rehash(size_type cnt)
   swap(temp);
 }
 
+template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
+void rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::start_rehash(size_type new_capacity)
+{
+  finish_rehash();
+  stored_value* old_data = data_;
+  unsigned char* old_raw = raw_;
+  size_type old_capacity = capacity_;
+  allocate(new_capacity);
+  old_data_ = old_data;
+  old_raw_ = old_raw;
+  old_capacity_ = old_capacity;
+  old_size_ = size_;
+  migrated_ = 0;
+  if (old_size_ == 0)
+  {
+    release_old();
+  }
+}
+template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
+void rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::finish_rehash()
+{
+  migrate_buckets(~0ULL);
+}
+template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
+void rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::migrate_buckets(size_type budget)
+{
+  if (old_data_ == nullptr)
+  {
+    return;
+  }
+  for (; (budget != 0) && (old_size_ != 0); budget--)
+  {
+    if (old_data_[migrated_].first == ~0ULL)
+    {
+      migrated_++;
+    }
+    else
+    {
+      migrate_slot(old_data_ + migrated_);
+    }
+  }
+  if (old_size_ == 0)
+  {
+    release_old();
+  }
+}
+template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
+template< class K1 >
+void rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::migrate_key(const K1& key)
+{
+  if (old_data_ == nullptr)
+  {
+    return;
+  }
+  size_type slot = hash_(key) % old_capacity_;
+  for (size_type i = 0; (old_data_[slot].first != ~0ULL) && (old_data_[slot].first >= i);)
+  {
+    if ((old_data_[slot].first == i) && equal_(get_key(old_data_[slot].second), key))
+    {
+      migrate_slot(old_data_ + slot);
+      if (!IsMulti)
+      {
+        return;
+      }
+    }
+    else
+    {
+      i++;
+      slot = (++slot < old_capacity_ ? slot : slot - old_capacity_);
+    }
+  }
+}
+template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
+void rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::migrate_slot(stored_value* pos)
+{
+  static_assert(std::is_nothrow_move_constructible< temp_value >::value, "");
+  temp_value temp{std::move(*reinterpret_cast< temp_value* >(std::addressof(pos->second)))};
+  pos->second.~value_type();
+  pos->first = ~0ULL;
+  close_old_gap(pos);
+  old_size_--;
+  place(std::move(temp));
+}
+template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
+void rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::close_old_gap(stored_value* pos) noexcept
+{
+  stored_value* old_end = old_data_ + old_capacity_;
+  for (stored_value* next = (pos + 1 == old_end ? old_data_ : pos + 1);
+        (next->first != ~0ULL) && (next->first != 0); next = (pos + 1 == old_end ? old_data_ : pos + 1))
+  {
+    new(std::addressof(pos->second)) value_type(std::move(reinterpret_cast< temp_stored* >(next)->second));
+    next->second.~value_type();
+    pos->first = next->first - 1;
+    next->first = ~0ULL;
+    pos = next;
+  }
+}
+template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
+void rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::release_old() noexcept
+{
+  delete[] old_raw_;
+  old_capacity_ = 0;
+  old_size_ = 0;
+  migrated_ = 0;
+  old_data_ = nullptr;
+  old_raw_ = nullptr;
+}
+template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
+bool rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::is_old(const stored_value* pos) const noexcept
+{
+  std::less< const stored_value* > less;
+  return (old_data_ != nullptr) && !less(pos, old_data_) && less(pos, old_data_ + old_capacity_);
+}
+template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
+typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::iterator
+    rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::make_iterator(stored_value* pos) const noexcept
+{
+  if (old_data_ == nullptr)
+  {
+    return {pos, data_ + capacity_};
+  }
+  return {pos, data_ + capacity_, old_data_ + old_capacity_, data_};
+}
+template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
+typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::stored_value*
+    rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::first_slot() const noexcept
+{
+  if (old_size_ == 0)
+  {
+    return cached_begin_;
+  }
+  stored_value* result = old_data_ + migrated_;
+  for (; result->first == ~0ULL; ++result)
+  {}
+  return result;
+}
+template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
+void rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::place(temp_value&& value)
+{
+  temp_stored temp = {0, std::move(value)};
+  stored_value* pos = data_ + hash_(get_key(temp.second)) % capacity_;
+  for (; pos->first != ~0ULL; temp.first++, pos = (pos + 1 == data_ + capacity_ ? data_ : pos + 1))
+  {
+    if (pos->first < temp.first)
+    {
+      std::swap(temp, *reinterpret_cast< temp_stored* >(pos));
+    }
+  }
+  new(reinterpret_cast< temp_value* >(std::addressof(pos->second))) temp_value{std::move(temp.second)};
+  pos->first = temp.first;
+  if ((cached_begin_ == nullptr) || (pos < cached_begin_))
+  {
+    cached_begin_ = pos;
+  }
+}
+
 template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
 template< class... Args >
 std::pair< typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::iterator, bool >
@@ -69,7 +235,7 @@ std::pair< typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::iterat
     (std::pair< const_iterator, bool > hint, Args&&... args)
 {
   static_assert(is_nothrow_swappable_v< temp_value >, "");
-  iterator result = {hint.first.data_, hint.first.end_};
+  iterator result = make_iterator(hint.first.data_);
   if (!hint.second)
   {
     return {result, false};
@@ -103,7 +269,19 @@ typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::iterator
 {
   static_assert(std::is_nothrow_move_constructible< temp_value >::value, "");
   pos.data_->second.~value_type();
-  iterator result = {pos.data_, pos.end_};
+  iterator result = make_iterator(pos.data_);
+  if (is_old(pos.data_))
+  {
+    pos.data_->first = ~0ULL;
+    close_old_gap(pos.data_);
+    old_size_--;
+    size_--;
+    if (result.data_->first == ~0ULL)
+    {
+      return ++result;
+    }
+    return result;
+  }
   size_type expected_psl = pos.data_->first, shift = 0;
   pos.data_->first = ~0ULL;
 
@@ -119,8 +297,11 @@ typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::iterator
 
     if ((pos.data_->first != expected_psl + shift) || (pos.data_->first == ~0ULL))
     {
-      new(std::addressof(erased->second)) value_type(std::move(reinterpret_cast< temp_stored* >(prev)->second));
-      prev->second.~value_type();
+      if (prev != erased)
+      {
+        new(std::addressof(erased->second)) value_type(std::move(reinterpret_cast< temp_stored* >(prev)->second));
+        prev->second.~value_type();
+      }
       erased->first = expected_psl;
       prev->first = ~0ULL;
 
@@ -128,7 +309,7 @@ typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::iterator
       {
         if (prev == cached_begin_)
         {
-          cached_begin_ = (++begin()).data_;
+          cached_begin_ = (++iterator{cached_begin_, data_ + capacity_}).data_;
         }
         size_--;
         if (result.data_->first == ~0ULL)
@@ -140,7 +321,7 @@ typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::iterator
 
       erased = prev;
       expected_psl = pos.data_->first - 1;
-      shift = 0;
+      shift = 1;
     }
     prev = pos.data_;
   }
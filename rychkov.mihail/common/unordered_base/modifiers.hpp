@@ -9,8 +9,10 @@
 template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
 template< class K1 >
 std::pair< typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::const_iterator, bool >
-    rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::find_hint_pair(const K1& key) const
+    rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::find_hint_pair(const K1& key)
 {
+  migrate_key(key);
+  migrate_buckets(rehash_step);
   size_type slot = hash_(key) % capacity_;
   for (size_type i = 0; (data_[slot].first != ~0ULL) && (data_[slot].first >= i); i++,
         slot = (++slot < capacity_ ? slot : slot - capacity_))
@@ -28,7 +30,7 @@ template< class K1 >
 std::pair< typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::const_iterator, bool >
     rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::correct_hint(const_iterator hint, const K1& key)
 {
-  if (extend(size_ + 1))
+  if (extend(size_ + 1) || (old_data_ != nullptr))
   {
     return find_hint_pair(key);
   }
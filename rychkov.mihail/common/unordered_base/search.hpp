@@ -19,23 +19,36 @@ const typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::key_type&
 
 template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
 template< class K1 >
-typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::const_iterator
+typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::stored_value*
     rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::find_impl(const K1& key) const
 {
   if (empty())
   {
-    return end();
+    return data_ + capacity_;
+  }
+  stored_value* result = find_impl(key, data_, capacity_);
+  if ((result == nullptr) && (old_size_ != 0))
+  {
+    result = find_impl(key, old_data_, old_capacity_);
   }
-  size_type slot = hash_(key) % capacity_;
-  for (size_type i = 0; (data_[slot].first != ~0ULL) && (data_[slot].first >= i); i++,
-        slot = (++slot < capacity_ ? slot : slot - capacity_))
+  return result == nullptr ? data_ + capacity_ : result;
+}
+template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
+template< class K1 >
+typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::stored_value*
+    rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::find_impl(const K1& key,
+      stored_value* data, size_type capacity) const
+{
+  size_type slot = hash_(key) % capacity;
+  for (size_type i = 0; (data[slot].first != ~0ULL) && (data[slot].first >= i); i++,
+        slot = (++slot < capacity ? slot : slot - capacity))
   {
-    if ((data_[slot].first == i) && equal_(get_key(data_[slot].second), key))
+    if ((data[slot].first == i) && equal_(get_key(data[slot].second), key))
     {
-      return {data_ + slot, data_ + capacity_};
+      return data + slot;
     }
   }
-  return end();
+  return nullptr;
 }
 template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
 template< class K1 >
@@ -46,11 +59,24 @@ typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::size_type
   {
     return 0;
   }
-  size_type slot = hash_(key) % capacity_, result = 0;
-  for (size_type i = 0; (data_[slot].first != ~0ULL) && (data_[slot].first >= i); i++,
-        slot = (++slot < capacity_ ? slot : slot - capacity_))
+  size_type result = count_impl(key, data_, capacity_);
+  if (old_size_ != 0)
+  {
+    result += count_impl(key, old_data_, old_capacity_);
+  }
+  return result;
+}
+template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
+template< class K1 >
+typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::size_type
+    rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::count_impl(const K1& key,
+      const stored_value* data, size_type capacity) const
+{
+  size_type slot = hash_(key) % capacity, result = 0;
+  for (size_type i = 0; (data[slot].first != ~0ULL) && (data[slot].first >= i); i++,
+        slot = (++slot < capacity ? slot : slot - capacity))
   {
-    if ((data_[slot].first == i) && equal_(get_key(data_[slot].second), key))
+    if ((data[slot].first == i) && equal_(get_key(data[slot].second), key))
     {
       result++;
     }
@@ -62,14 +88,13 @@ template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
 typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::iterator
     rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::find(const key_type& key)
 {
-  const_iterator result = find_impl(key);
-  return {result.data_, result.end_};
+  return make_iterator(find_impl(key));
 }
 template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
 typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::const_iterator
     rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::find(const key_type& key) const
 {
-  return find_impl(key);
+  return make_iterator(find_impl(key));
 }
 template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
 bool rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::contains(const key_type& key) const
@@ -89,8 +114,7 @@ typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::transparent_hash_
     < typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::iterator, K1 >
     rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::find(const K1& key)
 {
-  const_iterator result = find_impl(key);
-  return {result.data_, result.end_};
+  return make_iterator(find_impl(key));
 }
 template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
 template< class K1 >
@@ -98,7 +122,7 @@ typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::transparent_hash_
     < typename rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::const_iterator, K1 >
     rychkov::UnorderedBase< K, T, H, E, IsSet, IsMulti >::find(const K1& key) const
 {
-  return find_impl(key);
+  return make_iterator(find_impl(key));
 }
 template< class K, class T, class H, class E, bool IsSet, bool IsMulti >
 template< class K1 >
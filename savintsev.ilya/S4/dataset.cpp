@@ -26,7 +26,12 @@ namespace savintsev
       {
         if (file >> key >> value)
         {
-          values[key] = value;
+          size_t loaded = values.size();
+          Dataset::iterator it = values.try_emplace(values.cend(), key, std::move(value));
+          if (values.size() == loaded)
+          {
+            it->second = std::move(value);
+          }
         }
         else
         {
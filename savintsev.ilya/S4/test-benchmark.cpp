@@ -0,0 +1,67 @@
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <two-three-tree.h>
+
+namespace
+{
+  using Clock = std::chrono::steady_clock;
+  using Tree = savintsev::TwoThreeTree< int, std::string >;
+
+  std::vector< int > make_keys(size_t count, bool sorted)
+  {
+    std::vector< int > keys;
+    keys.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+      keys.push_back(sorted ? i : (i * 2654435761u) % count);
+    }
+    return keys;
+  }
+
+  double ns_per_op(Clock::time_point start, size_t ops)
+  {
+    std::chrono::duration< double, std::nano > time = Clock::now() - start;
+    return time.count() / ops;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(S4_dataset_benchmark, *boost::unit_test::disabled())
+
+BOOST_AUTO_TEST_CASE(load_dataset)
+{
+  std::cout << "keys\torder\tsubscript copy ns\ttry_emplace hint ns\n";
+  for (size_t size = 10000; size <= 1000000; size *= 10)
+  {
+    for (bool sorted: {true, false})
+    {
+      std::vector< int > keys = make_keys(size, sorted);
+      std::string value = "value-from-the-dataset-file";
+
+      Tree copied;
+      Clock::time_point start = Clock::now();
+      for (int key: keys)
+      {
+        copied[key] = value;
+      }
+      double subscript = ns_per_op(start, size);
+
+      Tree hinted;
+      start = Clock::now();
+      for (int key: keys)
+      {
+        std::string read = value;
+        hinted.try_emplace(hinted.cend(), key, std::move(read));
+      }
+      double hint = ns_per_op(start, size);
+
+      BOOST_TEST(copied.size() == size);
+      BOOST_TEST(hinted.size() == size);
+      std::cout << size << '\t' << (sorted ? "sorted" : "shuffled") << '\t' << subscript << '\t' << hint << '\n';
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -228,6 +228,64 @@ BOOST_AUTO_TEST_CASE(insert_operation)
   BOOST_CHECK(tree.at(1) == "one");
 }
 
+BOOST_AUTO_TEST_CASE(emplace_operations)
+{
+  savintsev::TwoThreeTree< int, std::string > tree;
+
+  auto res1 = tree.emplace(2, "two");
+  BOOST_CHECK(res1.second);
+  BOOST_CHECK(res1.first->second == "two");
+
+  std::pair< int, std::string > value(1, "one");
+  auto res2 = tree.insert(std::move(value));
+  BOOST_CHECK(res2.second);
+  BOOST_CHECK(tree.at(1) == "one");
+
+  std::string name = "dos";
+  auto res3 = tree.try_emplace(2, std::move(name));
+  BOOST_CHECK(!res3.second);
+  BOOST_CHECK(name == "dos");
+  BOOST_CHECK(tree.at(2) == "two");
+
+  auto res4 = tree.try_emplace(3, 3, 'c');
+  BOOST_CHECK(res4.second);
+  BOOST_CHECK(res4.first->second == "ccc");
+  BOOST_CHECK(tree.size() == 3);
+}
+
+BOOST_AUTO_TEST_CASE(append_hint)
+{
+  savintsev::TwoThreeTree< int, int > tree;
+  for (int i = 0; i < 1000; ++i)
+  {
+    auto it = tree.try_emplace(tree.cend(), i, i * 10);
+    BOOST_CHECK(it->first == i);
+    it = tree.emplace_hint(tree.cend(), i, -1);
+    BOOST_CHECK(it->second == i * 10);
+  }
+  auto it = tree.emplace_hint(tree.cend(), -5, -50);
+  BOOST_CHECK(it->first == -5);
+  BOOST_CHECK(tree.begin()->first == -5);
+
+  for (int i = 0; i < 1000; i += 3)
+  {
+    tree.erase(i);
+  }
+  it = tree.emplace_hint(tree.cend(), 2000, 20000);
+  BOOST_CHECK(it->first == 2000);
+  BOOST_CHECK((--tree.end())->first == 2000);
+
+  int prev = -10;
+  size_t count = 0;
+  for (auto jt = tree.begin(); jt != tree.end(); ++jt, ++count)
+  {
+    BOOST_CHECK(prev < jt->first);
+    prev = jt->first;
+  }
+  BOOST_CHECK(count == tree.size());
+  BOOST_CHECK(tree.at(998) == 9980);
+}
+
 BOOST_AUTO_TEST_CASE(erase_operation)
 {
   savintsev::TwoThreeTree< int, std::string > tree;
@@ -1,8 +1,10 @@
 #ifndef HASH_MAP_HPP
 #define HASH_MAP_HPP
+#include <array>
 #include <initializer_list>
 #include <iterator>
 #include <iostream>
+#include <type_traits>
 #include <vector>
 #include <boost/hash2/xxhash.hpp>
 #include <dynamic-array.hpp>
@@ -38,15 +40,13 @@ namespace savintsev
       FwdIter() = default;
       FwdIter(const FwdConstIter & other):
         parent_(const_cast< HashMap * >(other.parent_)),
-        pos_(other.pos_),
-        first_(other.first_)
+        pos_(other.pos_)
       {
         skip_empty();
       }
-      FwdIter(HashMap * parent, size_t pos, bool in_table1):
+      FwdIter(HashMap * parent, size_t pos):
         parent_(parent),
-        pos_(pos),
-        first_(in_table1)
+        pos_(pos)
       {
         skip_empty();
       }
@@ -69,7 +69,6 @@ namespace savintsev
     private:
       HashMap * parent_ = nullptr;
       size_t pos_ = 0;
-      bool first_ = true;
       void skip_empty();
     };
 
@@ -88,15 +87,13 @@ namespace savintsev
       FwdConstIter() = default;
       FwdConstIter(const FwdIter & it):
         parent_(it.parent_),
-        pos_(it.pos_),
-        first_(it.first_)
+        pos_(it.pos_)
       {
         skip_empty();
       }
-      FwdConstIter(const HashMap * parent, size_t pos, bool in_table1):
+      FwdConstIter(const HashMap * parent, size_t pos):
         parent_(parent),
-        pos_(pos),
-        first_(in_table1)
+        pos_(pos)
       {
         skip_empty();
       }
@@ -117,7 +114,6 @@ namespace savintsev
     private:
       const HashMap * parent_ = nullptr;
       size_t pos_ = 0;
-      bool first_ = true;
       void skip_empty();
     };
 
@@ -179,37 +175,60 @@ namespace savintsev
     void rehash(size_t n);
 
   private:
+    template< typename, typename, typename, typename, typename >
+    friend class HashMap;
 
-    std::vector< std::pair< std::pair< Key, T >, bool > > t1_;
-    std::vector< std::pair< std::pair< Key, T >, bool > > t2_;
+    // both tables and the stash share one array: buckets of table 1,
+    // then buckets of table 2, then STASH_SIZE overflow slots
+    using slot_type = std::pair< std::pair< Key, T >, bool >;
 
-    size_t capacity_;
+    size_t buckets_;
+    std::vector< slot_type > slots_;
     size_t size_;
-
-    static constexpr size_t MAX_ITERATIONS = 100;
-
-    double max_load_factor_ = 0.75;
-
-    T & insert_data(const Key & k);
+    size_t stashed_;
+
+    static constexpr size_t BUCKET_SIZE = 4;
+    static constexpr size_t STASH_SIZE = 4;
+    static constexpr size_t MAX_SEARCH = 256;
+
+    double max_load_factor_ = 0.9;
+
+    static size_t buckets_for(size_t size) noexcept;
+
+    size_t bucket1(const Key & k) const;
+    size_t bucket2(const Key & k) const;
+    size_t alternate(size_t pos) const;
+    size_t stash_begin() const noexcept;
+
+    size_t lookup(const Key & k) const;
+    size_t free_slot(size_t bucket) const noexcept;
+    size_t free_stash() const noexcept;
+    size_t make_room(size_t first, size_t second);
+    template< class V >
+    size_t place(V && value);
+    void relocate(HashMap & temp, std::true_type) const;
+    void relocate(HashMap & temp, std::false_type);
+    void release(size_t pos) noexcept;
   };
 
+  template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
+  constexpr size_t HashMap< Key, T, HS1, HS2, EQ >::BUCKET_SIZE;
+  template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
+  constexpr size_t HashMap< Key, T, HS1, HS2, EQ >::STASH_SIZE;
+  template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
+  constexpr size_t HashMap< Key, T, HS1, HS2, EQ >::MAX_SEARCH;
+
   template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
   HashMap< Key, T, HS1, HS2, EQ >::HashMap():
     HashMap(10)
   {}
   template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
   HashMap< Key, T, HS1, HS2, EQ >::HashMap(size_t size):
-    t1_(size),
-    t2_(size),
-    capacity_(size),
-    size_(0)
-  {
-    for (size_t i = 0; i < capacity_; ++i)
-    {
-      t1_[i].second = false;
-      t2_[i].second = false;
-    }
-  }
+    buckets_(buckets_for(size)),
+    slots_(2 * buckets_ * BUCKET_SIZE + STASH_SIZE),
+    size_(0),
+    stashed_(0)
+  {}
   template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
   template< class InputIterator >
   HashMap< Key, T, HS1, HS2, EQ >::HashMap(InputIterator first, InputIterator last):
@@ -229,7 +248,7 @@ namespace savintsev
   template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
   size_t HashMap< Key, T, HS1, HS2, EQ >::capacity() const
   {
-    return capacity_;
+    return 2 * buckets_ * BUCKET_SIZE;
   }
   template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
   bool HashMap< Key, T, HS1, HS2, EQ >::empty() const noexcept
@@ -239,27 +258,21 @@ namespace savintsev
   template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
   void HashMap< Key, T, HS1, HS2, EQ >::clear() noexcept
   {
-    for (size_t i = 0; i < capacity_; ++i)
+    for (size_t i = 0; i < slots_.size(); ++i)
     {
-      if (t1_[i].second)
-      {
-        t1_[i].second = false;
-      }
-      if (t2_[i].second)
-      {
-        t2_[i].second = false;
-      }
+      slots_[i].second = false;
     }
 
     size_ = 0;
+    stashed_ = 0;
   }
   template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
   void HashMap< Key, T, HS1, HS2, EQ >::swap(HashMap< Key, T, HS1, HS2, EQ > & rhs)
   {
-    t1_.swap(rhs.t1_);
-    t2_.swap(rhs.t2_);
-    std::swap(capacity_, rhs.capacity_);
+    slots_.swap(rhs.slots_);
+    std::swap(buckets_, rhs.buckets_);
     std::swap(size_, rhs.size_);
+    std::swap(stashed_, rhs.stashed_);
     std::swap(max_load_factor_, rhs.max_load_factor_);
   }
   template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
@@ -285,115 +298,82 @@ namespace savintsev
   template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
   T & HashMap< Key, T, HS1, HS2, EQ >::operator[](const Key & k)
   {
-    auto data = find(k);
-    if (data != end())
+    size_t pos = lookup(k);
+    if (pos == slots_.size())
     {
-      return data->second;
+      pos = place(val_type(k, T()));
     }
-    return insert_data(k);
+    return slots_[pos].first.second;
   }
   template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
   T & HashMap< Key, T, HS1, HS2, EQ >::operator[](Key && k)
   {
-    auto data = find(k);
-    if (data != end())
+    size_t pos = lookup(k);
+    if (pos == slots_.size())
     {
-      return data->second;
+      pos = place(val_type(std::move(k), T()));
     }
-    return insert_data(k);
+    return slots_[pos].first.second;
   }
   template< typename K, typename T, typename HS1, typename HS2, typename EQ >
   typename HashMap< K, T, HS1, HS2, EQ >::iterator HashMap< K, T, HS1, HS2, EQ >::begin() noexcept
   {
-    return iterator(this, 0, true);
+    return iterator(this, 0);
   }
   template< typename K, typename T, typename HS1, typename HS2, typename EQ >
   typename HashMap< K, T, HS1, HS2, EQ >::const_iterator HashMap< K, T, HS1, HS2, EQ >::begin() const noexcept
   {
-    return const_iterator(this, 0, true);
+    return const_iterator(this, 0);
   }
   template< typename K, typename T, typename HS1, typename HS2, typename EQ >
   typename HashMap< K, T, HS1, HS2, EQ >::const_iterator HashMap< K, T, HS1, HS2, EQ >::cbegin() const noexcept
   {
-    return const_iterator(this, 0, true);
+    return const_iterator(this, 0);
   }
   template< typename K, typename T, typename HS1, typename HS2, typename EQ >
   typename HashMap< K, T, HS1, HS2, EQ >::iterator HashMap< K, T, HS1, HS2, EQ >::end() noexcept
   {
-    return iterator(this, capacity_, false);
+    return iterator(this, slots_.size());
   }
   template< typename K, typename T, typename HS1, typename HS2, typename EQ >
   typename HashMap< K, T, HS1, HS2, EQ >::const_iterator HashMap< K, T, HS1, HS2, EQ >::end() const noexcept
   {
-    return const_iterator(this, capacity_, false);
+    return const_iterator(this, slots_.size());
   }
   template< typename K, typename T, typename HS1, typename HS2, typename EQ >
   typename HashMap< K, T, HS1, HS2, EQ >::const_iterator HashMap< K, T, HS1, HS2, EQ >::cend() const noexcept
   {
-    return const_iterator(this, capacity_, false);
+    return const_iterator(this, slots_.size());
   }
   template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
   size_t HashMap< Key, T, HS1, HS2, EQ >::erase(const Key & k)
   {
-    Key current_key = k;
-
-    size_t h1 = HS1{}(current_key) % capacity_;
-    if (t1_[h1].second)
+    size_t pos = lookup(k);
+    if (pos == slots_.size())
     {
-      Key old_key = t1_[h1].first.first;
-      if (EQ{}(current_key, old_key))
-      {
-        t1_[h1].second = false;
-        --size_;
-        return 1ull;
-      }
+      return 0ull;
     }
-
-    size_t h2 = HS2{}(current_key) % capacity_;
-    if (t2_[h2].second)
-    {
-      Key old_key = t2_[h2].first.first;
-      if (EQ{}(current_key, old_key))
-      {
-        t2_[h2].second = false;
-        --size_;
-        return 1ull;
-      }
-    }
-
-    return 0ull;
+    release(pos);
+    return 1ull;
   }
   template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
   typename HashMap< Key, T, HS1, HS2, EQ >::iterator HashMap< Key, T, HS1, HS2, EQ >::erase(const_iterator position)
   {
-    iterator it = find(position->first);
-    if (it != end())
+    if (position.pos_ >= slots_.size())
     {
-      if (it.first_)
-      {
-        t1_[it.pos_].second = false;
-      }
-      else
-      {
-        t2_[it.pos_].second = false;
-      }
-      --size_;
-      ++it;
+      return end();
     }
-    return it;
+    release(position.pos_);
+    return iterator(this, position.pos_ + 1);
   }
   template< typename K, typename T, typename H, typename N, typename E >
   typename HashMap< K, T, H, N, E >::iterator HashMap< K, T, H, N, E >::erase(const_iterator fst, const_iterator last)
   {
-    if (fst == cend())
-    {
-      return iterator(this, capacity_, false);
-    }
     for (auto it = fst; it != last;)
     {
       it = erase(it);
     }
-    return find(last->first);
+    return iterator(this, last.pos_);
   }
   template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
   template< class... Args >
@@ -406,15 +386,13 @@ namespace savintsev
   {
     std::pair< Key, T > temp(std::forward< Args >(args)...);
 
-    auto it = find(temp.first);
-    if (it != end())
+    size_t pos = lookup(temp.first);
+    if (pos != slots_.size())
     {
-      return {it, false};
+      return {iterator(this, pos), false};
     }
 
-    T & inserted = insert_data(temp.first);
-    inserted = std::move(temp.second);
-    return {find(temp.first), true};
+    return {iterator(this, place(std::move(temp))), true};
   }
   template< typename K, typename T, typename A, typename B, typename E >
   template< class... X >
@@ -430,14 +408,13 @@ namespace savintsev
   >
   HashMap< Key, T, HS1, HS2, EQ >::insert(const val_type & val)
   {
-    auto it = find(val.first);
-    if (it != end())
+    size_t pos = lookup(val.first);
+    if (pos != slots_.size())
     {
-      return {it, false};
+      return {iterator(this, pos), false};
     }
 
-    insert_data(val.first) = val.second;
-    return {find(val.first), true};
+    return {iterator(this, place(val)), true};
   }
   template< typename K, typename T, typename A, typename B, typename E >
   typename HashMap< K, T, A, B, E >::iterator HashMap< K, T, A, B, E >::insert(const_iterator hint, const val_type & v)
@@ -456,43 +433,17 @@ namespace savintsev
   template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
   typename HashMap< Key, T, HS1, HS2, EQ >::iterator HashMap< Key, T, HS1, HS2, EQ >::find(const Key & k)
   {
-    size_t h1 = HS1{}(k) % capacity_;
-    size_t h2 = HS2{}(k) % capacity_;
-
-    if (t1_[h1].second && EQ{}(t1_[h1].first.first, k))
-    {
-      return iterator(this, h1, true);
-    }
-
-    if (t2_[h2].second && EQ{}(t2_[h2].first.first, k))
-    {
-      return iterator(this, h2, false);
-    }
-
-    return iterator(this, capacity_, false);
+    return iterator(this, lookup(k));
   }
   template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
   typename HashMap< Key, T, HS1, HS2, EQ >::const_iterator HashMap< Key, T, HS1, HS2, EQ >::find(const Key & k) const
   {
-    size_t h1 = HS1{}(k) % capacity_;
-    size_t h2 = HS2{}(k) % capacity_;
-
-    if (t1_[h1].second && EQ{}(t1_[h1].first.first, k))
-    {
-      return const_iterator(this, h1, true);
-    }
-
-    if (t2_[h2].second && EQ{}(t2_[h2].first.first, k))
-    {
-      return const_iterator(this, h2, false);
-    }
-
-    return const_iterator(this, capacity_, false);
+    return const_iterator(this, lookup(k));
   }
   template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
   float HashMap< Key, T, HS1, HS2, EQ >::load_factor() const noexcept
   {
-    return static_cast< double >(size_) / capacity_;
+    return static_cast< double >(size_) / capacity();
   }
   template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
   float HashMap< Key, T, HS1, HS2, EQ >::max_load_factor() const noexcept
@@ -510,102 +461,279 @@ namespace savintsev
   template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
   void HashMap< Key, T, HS1, HS2, EQ >::rehash(size_t n)
   {
-    std::vector< std::pair< std::pair< Key, T >, bool > > new_t1(n);
-    std::vector< std::pair< std::pair< Key, T >, bool > > new_t2(n);
+    using trivial = std::integral_constant< bool,
+      std::is_trivially_copyable< Key >::value && std::is_trivially_copyable< T >::value >;
 
-    const size_t old_capacity = capacity_;
-    const size_t old_size = size_;
+    HashMap< Key, T, HS1, HS2, EQ > temp(n);
+    temp.max_load_factor_ = max_load_factor_;
+    relocate(temp, trivial{});
+    swap(temp);
+  }
+  template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
+  void HashMap< Key, T, HS1, HS2, EQ >::relocate(HashMap & temp, std::true_type) const
+  {
+    // moving a trivially copyable element copies it, so a throwing hasher
+    // leaves this table as it was
+    for (size_t i = 0; i < slots_.size(); ++i)
+    {
+      if (slots_[i].second)
+      {
+        temp.place(slots_[i].first);
+      }
+    }
+  }
+  template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
+  void HashMap< Key, T, HS1, HS2, EQ >::relocate(HashMap & temp, std::false_type)
+  {
+    // lay the table out on pointers first: hashing, evictions and growth all
+    // happen there, and nothing is moved until the final position of every
+    // element is known
+    using source = std::pair< Key, T > *;
+    HashMap< source, char, IndirectHash< HS1 >, IndirectHash< HS2 >, std::equal_to< source > > layout(temp.capacity());
+    layout.max_load_factor_ = max_load_factor_;
+    for (size_t i = 0; i < slots_.size(); ++i)
+    {
+      if (slots_[i].second)
+      {
+        layout.place(std::make_pair(std::addressof(slots_[i].first), char()));
+      }
+    }
 
-    std::swap(t1_, new_t1);
-    std::swap(t2_, new_t2);
+    if (layout.buckets_ != temp.buckets_)
+    {
+      HashMap< Key, T, HS1, HS2, EQ > grown(layout.capacity());
+      grown.max_load_factor_ = max_load_factor_;
+      temp.swap(grown);
+    }
 
-    capacity_ = n;
-    size_ = 0;
+    // a move that may throw is replaced by a copy, so this table stays
+    // intact until the swap
+    using relocated = typename std::conditional< std::is_nothrow_move_assignable< val_type >::value,
+      val_type &&, const val_type & >::type;
+    for (size_t i = 0; i < layout.slots_.size(); ++i)
+    {
+      if (layout.slots_[i].second)
+      {
+        temp.slots_[i].first = static_cast< relocated >(*layout.slots_[i].first.first);
+        temp.slots_[i].second = true;
+      }
+    }
+    temp.size_ = layout.size_;
+    temp.stashed_ = layout.stashed_;
+  }
+  template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
+  size_t HashMap< Key, T, HS1, HS2, EQ >::buckets_for(size_t size) noexcept
+  {
+    size_t buckets = (size + 2 * BUCKET_SIZE - 1) / (2 * BUCKET_SIZE);
+    return buckets == 0 ? 1 : buckets;
+  }
+  template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
+  size_t HashMap< Key, T, HS1, HS2, EQ >::bucket1(const Key & k) const
+  {
+    return HS1{}(k) % buckets_;
+  }
+  template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
+  size_t HashMap< Key, T, HS1, HS2, EQ >::bucket2(const Key & k) const
+  {
+    return buckets_ + HS2{}(k) % buckets_;
+  }
+  template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
+  size_t HashMap< Key, T, HS1, HS2, EQ >::alternate(size_t pos) const
+  {
+    const Key & k = slots_[pos].first.first;
+    return pos / BUCKET_SIZE < buckets_ ? bucket2(k) : bucket1(k);
+  }
+  template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
+  size_t HashMap< Key, T, HS1, HS2, EQ >::stash_begin() const noexcept
+  {
+    return 2 * buckets_ * BUCKET_SIZE;
+  }
+  template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
+  size_t HashMap< Key, T, HS1, HS2, EQ >::lookup(const Key & k) const
+  {
+    size_t pos = bucket1(k) * BUCKET_SIZE;
+    for (size_t i = pos; i < pos + BUCKET_SIZE; ++i)
+    {
+      if (slots_[i].second && EQ{}(slots_[i].first.first, k))
+      {
+        return i;
+      }
+    }
 
-    try
+    pos = bucket2(k) * BUCKET_SIZE;
+    for (size_t i = pos; i < pos + BUCKET_SIZE; ++i)
     {
-      for (size_t i = 0; i < old_capacity; ++i)
+      if (slots_[i].second && EQ{}(slots_[i].first.first, k))
       {
-        if (new_t1[i].second)
-        {
-          insert_data(new_t1[i].first.first) = new_t1[i].first.second;
-        }
-        if (new_t2[i].second)
+        return i;
+      }
+    }
+
+    if (stashed_ != 0)
+    {
+      for (size_t i = stash_begin(); i < slots_.size(); ++i)
+      {
+        if (slots_[i].second && EQ{}(slots_[i].first.first, k))
         {
-          insert_data(new_t2[i].first.first) = new_t2[i].first.second;
+          return i;
         }
       }
     }
-    catch (...)
+
+    return slots_.size();
+  }
+  template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
+  size_t HashMap< Key, T, HS1, HS2, EQ >::free_slot(size_t bucket) const noexcept
+  {
+    size_t pos = bucket * BUCKET_SIZE;
+    for (size_t i = pos; i < pos + BUCKET_SIZE; ++i)
+    {
+      if (!slots_[i].second)
+      {
+        return i;
+      }
+    }
+    return slots_.size();
+  }
+  template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
+  size_t HashMap< Key, T, HS1, HS2, EQ >::free_stash() const noexcept
+  {
+    for (size_t i = stash_begin(); i < slots_.size(); ++i)
     {
-      std::swap(t1_, new_t1);
-      std::swap(t2_, new_t2);
-      capacity_ = old_capacity;
-      size_ = old_size;
-      throw;
+      if (!slots_[i].second)
+      {
+        return i;
+      }
     }
+    return slots_.size();
   }
   template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
-  T & HashMap< Key, T, HS1, HS2, EQ >::insert_data(const Key & k)
+  size_t HashMap< Key, T, HS1, HS2, EQ >::make_room(size_t first, size_t second)
   {
-    Key original_key = k;
-
-    Key current_key = k;
-    T current_value = T{};
-    size_t attempts = 0;
-    bool is_inserted = false;
+    // breadth-first search for the shortest chain of evictions ending in a
+    // bucket with a free slot; every step remembers which slot of its parent
+    // bucket has to move into it
+    struct Step
+    {
+      size_t bucket;
+      size_t parent;
+      size_t slot;
+    };
+    const size_t none = slots_.size();
 
-    if (load_factor() > max_load_factor_)
+    // buckets already queued live in a small open-addressing set, so the
+    // search stays linear in the number of steps
+    constexpr size_t QUEUED_SIZE = 2 * MAX_SEARCH;
+    std::array< size_t, QUEUED_SIZE > queued;
+    queued.fill(none);
+    queued[first % QUEUED_SIZE] = first;
+    size_t probe = second % QUEUED_SIZE;
+    while (queued[probe] != none)
     {
-      rehash(capacity_ * 2);
+      probe = (probe + 1) % QUEUED_SIZE;
     }
+    queued[probe] = second;
+
+    std::array< Step, MAX_SEARCH > steps;
+    size_t count = 0;
+    steps[count++] = {first, none, none};
+    steps[count++] = {second, none, none};
 
-    while (attempts < MAX_ITERATIONS)
+    for (size_t i = 0; i < count; ++i)
     {
-      size_t h1 = HS1{}(current_key) % capacity_;
-      if (!t1_[h1].second)
+      size_t pos = steps[i].bucket * BUCKET_SIZE;
+      for (size_t j = pos; j < pos + BUCKET_SIZE; ++j)
       {
-        t1_[h1] = {{current_key, current_value}, true};
-        size_++;
-        is_inserted = true;
-        break;
-      }
-
-      auto displaced = t1_[h1];
-      t1_[h1] = {{current_key, current_value}, true};
-      current_key = displaced.first.first;
-      current_value = displaced.first.second;
-      attempts++;
+        size_t target = alternate(j);
+        size_t vacant = free_slot(target);
+        if (vacant != none)
+        {
+          slots_[vacant].first = std::move(slots_[j].first);
+          slots_[vacant].second = true;
+          size_t hole = j;
+          for (size_t k = i; steps[k].parent != none; k = steps[k].parent)
+          {
+            slots_[hole].first = std::move(slots_[steps[k].slot].first);
+            hole = steps[k].slot;
+          }
+          slots_[hole].second = false;
+          return hole;
+        }
 
-      size_t h2 = HS2{}(current_key) % capacity_;
-      if (!t2_[h2].second)
-      {
-        t2_[h2] = {{current_key, current_value}, true};
-        size_++;
-        is_inserted = true;
-        break;
+        if (count == MAX_SEARCH)
+        {
+          continue;
+        }
+        probe = target % QUEUED_SIZE;
+        while (queued[probe] != none && queued[probe] != target)
+        {
+          probe = (probe + 1) % QUEUED_SIZE;
+        }
+        if (queued[probe] == none)
+        {
+          queued[probe] = target;
+          steps[count++] = {target, i, j};
+        }
       }
+    }
 
-      displaced = t2_[h2];
-      t2_[h2] = {{current_key, current_value}, true};
-      current_key = displaced.first.first;
-      current_value = displaced.first.second;
-      attempts++;
+    return none;
+  }
+  template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
+  template< class V >
+  size_t HashMap< Key, T, HS1, HS2, EQ >::place(V && value)
+  {
+    if (size_ + 1 > max_load_factor_ * capacity())
+    {
+      rehash(capacity() * 2);
     }
 
-    if (!is_inserted)
+    size_t first = bucket1(value.first);
+    size_t second = bucket2(value.first);
+
+    size_t pos = free_slot(first);
+    if (pos == slots_.size())
+    {
+      pos = free_slot(second);
+    }
+    if (pos == slots_.size())
     {
-      rehash(capacity_ * 2);
-      insert_data(current_key) = current_value;
+      pos = make_room(first, second);
+    }
+    if (pos == slots_.size())
+    {
+      pos = free_stash();
+    }
+    if (pos == slots_.size())
+    {
+      rehash(capacity() * 2);
+      return place(std::forward< V >(value));
     }
 
-    return find(original_key)->second;
+    slots_[pos].first = std::forward< V >(value);
+    slots_[pos].second = true;
+    ++size_;
+    if (pos >= stash_begin())
+    {
+      ++stashed_;
+    }
+    return pos;
+  }
+  template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
+  void HashMap< Key, T, HS1, HS2, EQ >::release(size_t pos) noexcept
+  {
+    slots_[pos].second = false;
+    --size_;
+    if (pos >= stash_begin())
+    {
+      --stashed_;
+    }
   }
 
   template< typename K, typename T, typename H1, typename H2, typename EQ >
   typename HashMap< K, T, H1, H2, EQ >::FwdIter::reference HashMap< K, T, H1, H2, EQ >::FwdIter::operator*()
   {
-    return first_ ? parent_->t1_[pos_].first : parent_->t2_[pos_].first;
+    return parent_->slots_[pos_].first;
   }
   template< typename K, typename T, typename H1, typename H2, typename EQ >
   typename HashMap< K, T, H1, H2, EQ >::FwdIter::pointer HashMap< K, T, H1, H2, EQ >::FwdIter::operator->()
@@ -615,7 +743,7 @@ namespace savintsev
   template< typename K, typename T, typename H1, typename H2, typename EQ >
   typename HashMap< K, T, H1, H2, EQ >::FwdIter::reference HashMap< K, T, H1, H2, EQ >::FwdIter::operator*() const
   {
-    return first_ ? parent_->t1_[pos_].first : parent_->t2_[pos_].first;
+    return parent_->slots_[pos_].first;
   }
   template< typename K, typename T, typename H1, typename H2, typename EQ >
   typename HashMap< K, T, H1, H2, EQ >::FwdIter::pointer HashMap< K, T, H1, H2, EQ >::FwdIter::operator->() const
@@ -644,31 +772,12 @@ namespace savintsev
   template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
   bool HashMap< Key, T, HS1, HS2, EQ >::FwdIter::operator==(const FwdIter & rhs) const
   {
-    if (parent_ != rhs.parent_)
-    {
-      return false;
-    }
-    bool c1 = parent_ && pos_ >= parent_->capacity_ && !first_;
-    bool c2 = rhs.parent_ && rhs.pos_ >= rhs.parent_->capacity_ && !rhs.first_;
-    if (c1 && c2)
-    {
-      return true;
-    }
-    return pos_ == rhs.pos_ && first_ == rhs.first_;
+    return parent_ == rhs.parent_ && pos_ == rhs.pos_;
   }
   template< typename K, typename T, typename H1, typename H2, typename EQ >
   void HashMap< K, T, H1, H2, EQ >::FwdIter::skip_empty()
   {
-    while (first_ && (pos_ < parent_->capacity_) && !parent_->t1_[pos_].second)
-    {
-      ++pos_;
-    }
-    if ((pos_ >= parent_->capacity_) && first_)
-    {
-      first_ = false;
-      pos_ = 0;
-    }
-    while (!first_ && (pos_ < parent_->capacity_) && (!parent_->t2_[pos_].second))
+    while ((pos_ < parent_->slots_.size()) && !parent_->slots_[pos_].second)
     {
       ++pos_;
     }
@@ -677,7 +786,7 @@ namespace savintsev
   template< typename K, typename T, typename A, typename B, typename E >
   typename HashMap< K, T, A, B, E >::FwdConstIter::reference HashMap< K, T, A, B, E >::FwdConstIter::operator*() const
   {
-    return first_ ? parent_->t1_[pos_].first : parent_->t2_[pos_].first;
+    return parent_->slots_[pos_].first;
   }
   template< typename K, typename T, typename A, typename B, typename E >
   typename HashMap< K, T, A, B, E >::FwdConstIter::pointer HashMap< K, T, A, B, E >::FwdConstIter::operator->() const
@@ -694,7 +803,7 @@ namespace savintsev
   template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
   typename HashMap< Key, T, HS1, HS2, EQ >::FwdConstIter HashMap< Key, T, HS1, HS2, EQ >::FwdConstIter::operator++(int)
   {
-    FwdIter result(*this);
+    FwdConstIter result(*this);
     ++(*this);
     return result;
   }
@@ -706,31 +815,12 @@ namespace savintsev
   template< typename Key, typename T, typename HS1, typename HS2, typename EQ >
   bool HashMap< Key, T, HS1, HS2, EQ >::FwdConstIter::operator==(const FwdConstIter & rhs) const
   {
-    if (parent_ != rhs.parent_)
-    {
-      return false;
-    }
-    bool c1 = parent_ && pos_ >= parent_->capacity_ && !first_;
-    bool c2 = rhs.parent_ && rhs.pos_ >= rhs.parent_->capacity_ && !rhs.first_;
-    if (c1 && c2)
-    {
-      return true;
-    }
-    return pos_ == rhs.pos_ && first_ == rhs.first_;
+    return parent_ == rhs.parent_ && pos_ == rhs.pos_;
   }
   template< typename K, typename T, typename H1, typename H2, typename EQ >
   void HashMap< K, T, H1, H2, EQ >::FwdConstIter::skip_empty()
   {
-    while (first_ && (pos_ < parent_->capacity_) && !parent_->t1_[pos_].second)
-    {
-      ++pos_;
-    }
-    if ((pos_ >= parent_->capacity_) && first_)
-    {
-      first_ = false;
-      pos_ = 0;
-    }
-    while (!first_ && (pos_ < parent_->capacity_) && (!parent_->t2_[pos_].second))
+    while ((pos_ < parent_->slots_.size()) && !parent_->slots_[pos_].second)
     {
       ++pos_;
     }
@@ -16,6 +16,17 @@ namespace savintsev
       return boost::hash2::get_integral_result< size_t >(h);
     }
   };
+
+  template< class H >
+  struct IndirectHash
+  {
+  public:
+    template< class T >
+    size_t operator()(const T * p) const
+    {
+      return H{}(p->first);
+    }
+  };
 }
 
 #endif
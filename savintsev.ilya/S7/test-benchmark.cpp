@@ -0,0 +1,95 @@
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "cuckoo-hash-map.h"
+
+using namespace savintsev;
+
+namespace
+{
+  using Clock = std::chrono::steady_clock;
+
+  std::vector< std::string > make_keys(size_t count, size_t offset)
+  {
+    std::vector< std::string > keys;
+    keys.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+      keys.push_back("vertex-" + std::to_string((offset + i) * 2654435761u));
+    }
+    return keys;
+  }
+
+  double ns_per_op(Clock::time_point start, size_t ops)
+  {
+    std::chrono::duration< double, std::nano > time = Clock::now() - start;
+    return time.count() / ops;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(S7_hash_map_benchmark, *boost::unit_test::disabled())
+
+BOOST_AUTO_TEST_CASE(fixed_capacity_load)
+{
+  std::cout << "load\tcapacity\tgrown to\tinsert ns\thit ns\tmiss ns\n";
+  const float loads[] = {0.5f, 0.75f, 0.9f, 0.95f};
+  for (float load: loads)
+  {
+    HashMap< std::string, size_t > hm(1 << 18);
+    hm.max_load_factor(0.99f);
+    const size_t capacity = hm.capacity();
+    std::vector< std::string > keys = make_keys(capacity * load, 0);
+    std::vector< std::string > missing = make_keys(keys.size(), keys.size());
+
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+      hm[keys[i]] = i;
+    }
+    double insert = ns_per_op(start, keys.size());
+
+    size_t found = 0;
+    start = Clock::now();
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+      found += hm.find(keys[i]) != hm.end();
+    }
+    double hit = ns_per_op(start, keys.size());
+
+    start = Clock::now();
+    for (size_t i = 0; i < missing.size(); ++i)
+    {
+      found += hm.find(missing[i]) != hm.end();
+    }
+    double miss = ns_per_op(start, missing.size());
+
+    BOOST_TEST(found == keys.size());
+    std::cout << load << '\t' << capacity << '\t' << hm.capacity() << '\t';
+    std::cout << insert << '\t' << hit << '\t' << miss << '\n';
+  }
+}
+
+BOOST_AUTO_TEST_CASE(growing_with_heavy_values)
+{
+  std::cout << "keys\tvalue ints\tinsert ns\n";
+  const size_t sizes[] = {0, 16, 256};
+  for (size_t ints: sizes)
+  {
+    std::vector< std::string > keys = make_keys(100000, 0);
+    HashMap< std::string, std::vector< int > > hm;
+
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+      hm[keys[i]].assign(ints, 1);
+    }
+    double insert = ns_per_op(start, keys.size());
+
+    BOOST_TEST(hm.size() == keys.size());
+    std::cout << keys.size() << '\t' << ints << '\t' << insert << '\n';
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
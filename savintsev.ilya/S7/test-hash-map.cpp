@@ -1,5 +1,6 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/hash2/xxhash.hpp>
+#include <stdexcept>
 #include <string>
 #include <iostream>
 #include "cuckoo-hash-map.h"
@@ -411,3 +412,179 @@ BOOST_AUTO_TEST_CASE(hm_emplace_insert_test)
   BOOST_TEST(res3.second);
   BOOST_TEST(hm["b"] == 2);
 }
+
+namespace
+{
+  struct CopyCounter
+  {
+    static size_t copies;
+    int value = 0;
+
+    CopyCounter() = default;
+    CopyCounter(int v):
+      value(v)
+    {}
+    CopyCounter(const CopyCounter & rhs):
+      value(rhs.value)
+    {
+      ++copies;
+    }
+    CopyCounter(CopyCounter && rhs) noexcept = default;
+    CopyCounter & operator=(const CopyCounter & rhs)
+    {
+      value = rhs.value;
+      ++copies;
+      return *this;
+    }
+    CopyCounter & operator=(CopyCounter && rhs) noexcept = default;
+  };
+  size_t CopyCounter::copies = 0;
+
+  struct FragileValue
+  {
+    static bool armed;
+    std::string value;
+
+    FragileValue() = default;
+    FragileValue(const std::string & v):
+      value(v)
+    {}
+    FragileValue(const FragileValue & rhs) = default;
+    FragileValue(FragileValue && rhs) noexcept = default;
+    FragileValue & operator=(const FragileValue & rhs)
+    {
+      if (armed)
+      {
+        throw std::runtime_error("copy failed");
+      }
+      value = rhs.value;
+      return *this;
+    }
+    FragileValue & operator=(FragileValue && rhs) noexcept(false)
+    {
+      value = std::move(rhs.value);
+      return *this;
+    }
+  };
+  bool FragileValue::armed = false;
+
+  struct ZeroHash
+  {
+    size_t operator()(int) const
+    {
+      return 0;
+    }
+  };
+}
+
+BOOST_AUTO_TEST_CASE(hm_displacement_without_copies)
+{
+  HashMap< int, CopyCounter > hm(4);
+  CopyCounter::copies = 0;
+
+  for (int i = 0; i < 5000; ++i)
+  {
+    hm[i] = CopyCounter(i);
+  }
+  for (int i = 0; i < 5000; ++i)
+  {
+    hm.emplace(i + 5000, CopyCounter(i));
+  }
+
+  BOOST_TEST(CopyCounter::copies == 0);
+  BOOST_TEST(hm.size() == 10000);
+  for (int i = 0; i < 5000; ++i)
+  {
+    BOOST_TEST(hm.at(i).value == i);
+    BOOST_TEST(hm.at(i + 5000).value == i);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(hm_high_load_factor)
+{
+  HashMap< int, int > hm(1000);
+  hm.max_load_factor(0.95f);
+  const size_t capacity = hm.capacity();
+  const int count = static_cast< int >(capacity * 0.94);
+
+  for (int i = 0; i < count; ++i)
+  {
+    hm[i * 7] = i;
+  }
+
+  BOOST_TEST(hm.capacity() == capacity);
+  BOOST_TEST(hm.load_factor() > 0.9f);
+  for (int i = 0; i < count; ++i)
+  {
+    BOOST_TEST(hm[i * 7] == i);
+  }
+
+  size_t visited = 0;
+  for (auto it = hm.begin(); it != hm.end(); ++it)
+  {
+    ++visited;
+  }
+  BOOST_TEST(visited == hm.size());
+}
+
+BOOST_AUTO_TEST_CASE(hm_stash)
+{
+  HashMap< int, int, ZeroHash, ZeroHash > hm(64);
+
+  for (int i = 0; i < 12; ++i)
+  {
+    hm[i] = i * 10;
+  }
+  BOOST_TEST(hm.size() == 12);
+  BOOST_TEST(hm.capacity() == 64);
+  for (int i = 0; i < 12; ++i)
+  {
+    BOOST_TEST(hm.at(i) == i * 10);
+  }
+
+  size_t visited = 0;
+  for (auto it = hm.cbegin(); it != hm.cend(); ++it)
+  {
+    ++visited;
+  }
+  BOOST_TEST(visited == 12);
+
+  BOOST_TEST(hm.erase(11) == 1);
+  BOOST_TEST(hm.erase(3) == 1);
+  BOOST_TEST(hm.find(11) == hm.end());
+  BOOST_TEST(hm.find(3) == hm.end());
+  hm[100] = 1000;
+  hm[101] = 1010;
+  BOOST_TEST(hm.size() == 12);
+  BOOST_TEST(hm.at(100) == 1000);
+  BOOST_TEST(hm.at(101) == 1010);
+  BOOST_TEST(hm.at(10) == 100);
+}
+
+BOOST_AUTO_TEST_CASE(hm_rehash_strong_guarantee)
+{
+  HashMap< std::string, FragileValue > hm(16);
+  for (int i = 0; i < 100; ++i)
+  {
+    hm[std::to_string(i)] = FragileValue("value-" + std::to_string(i));
+  }
+  const size_t capacity = hm.capacity();
+
+  FragileValue::armed = true;
+  BOOST_CHECK_THROW(hm.rehash(capacity * 2), std::runtime_error);
+  FragileValue::armed = false;
+
+  BOOST_TEST(hm.size() == 100);
+  BOOST_TEST(hm.capacity() == capacity);
+  for (int i = 0; i < 100; ++i)
+  {
+    BOOST_TEST(hm.at(std::to_string(i)).value == "value-" + std::to_string(i));
+  }
+
+  hm.rehash(capacity * 2);
+  BOOST_TEST(hm.capacity() == capacity * 2);
+  for (int i = 0; i < 100; ++i)
+  {
+    BOOST_TEST(hm.at(std::to_string(i)).value == "value-" + std::to_string(i));
+  }
+}
@@ -4,6 +4,8 @@
 #include <iostream>
 #include <cassert>
 #include <queue>
+#include <tuple>
+#include <utility>
 #include "ttt-node.hpp"
 #include "ttt-iterator.hpp"
 #include "ttt-const-iterator.hpp"
@@ -56,6 +58,20 @@ namespace savintsev
     mapped_type & operator[](key_type && k);
 
     std::pair< iterator, bool > insert(const value_type & val);
+    std::pair< iterator, bool > insert(value_type && val);
+
+    template< typename... Args >
+    std::pair< iterator, bool > emplace(Args &&... args);
+    template< typename... Args >
+    iterator emplace_hint(const_iterator hint, Args &&... args);
+    template< typename... Args >
+    std::pair< iterator, bool > try_emplace(const key_type & k, Args &&... args);
+    template< typename... Args >
+    std::pair< iterator, bool > try_emplace(key_type && k, Args &&... args);
+    template< typename... Args >
+    iterator try_emplace(const_iterator hint, const key_type & k, Args &&... args);
+    template< typename... Args >
+    iterator try_emplace(const_iterator hint, key_type && k, Args &&... args);
 
     iterator erase(const_iterator position);
     size_type erase(const key_type & k);
@@ -77,13 +93,17 @@ namespace savintsev
     F traverse_breadth(F f);
   private:
     node_type * root_ = nullptr;
+    node_type * rightmost_ = nullptr;
     size_t size_ = 0;
 
     std::pair< iterator, bool > lazy_find(const key_type & k) const;
-    std::pair< iterator, bool > insert_node(node_type * target, const value_type & val);
+    std::pair< iterator, bool > insert_node(node_type * target, value_type && val);
+    node_type * rightmost_leaf();
+    bool is_append(const_iterator hint, const key_type & k);
 
     node_type * split_node(node_type * node);
-    void insert_data_in_node(node_type * node, const value_type & val);
+    template< typename T >
+    size_t insert_data_in_node(node_type * node, T && val);
     void remove_data_from_node(node_type * node, const value_type & val);
     void remove_data_from_node(node_type * node, const key_type & k);
     node_type * clear_nodes(node_type * node);
@@ -134,9 +154,11 @@ namespace savintsev
   template< typename Key, typename Value, typename Compare >
   TwoThreeTree< Key, Value, Compare >::TwoThreeTree(TwoThreeTree && other) noexcept:
     root_(other.root_),
+    rightmost_(other.rightmost_),
     size_(other.size_)
   {
     other.root_ = nullptr;
+    other.rightmost_ = nullptr;
     other.size_ = 0;
   }
 
@@ -147,8 +169,10 @@ namespace savintsev
     {
       root_ = clear_nodes(root_);
       root_ = other.root_;
+      rightmost_ = other.rightmost_;
       size_ = other.size_;
       other.root_ = nullptr;
+      other.rightmost_ = nullptr;
       other.size_ = 0;
     }
     return *this;
@@ -211,6 +235,7 @@ namespace savintsev
   void TwoThreeTree< Key, Value, Compare >::clear() noexcept
   {
     root_ = clear_nodes(root_);
+    rightmost_ = nullptr;
     size_ = 0;
   }
 
@@ -235,6 +260,7 @@ namespace savintsev
   void TwoThreeTree< Key, Value, Compare >::swap(TwoThreeTree & other) noexcept
   {
     std::swap(root_, other.root_);
+    std::swap(rightmost_, other.rightmost_);
     std::swap(size_, other.size_);
   }
 
@@ -353,7 +379,7 @@ namespace savintsev
     typename TwoThreeTree< K, V, C >::iterator,
     bool
   >
-  TwoThreeTree< K, V, C >::insert_node(node_type * target, const value_type & val)
+  TwoThreeTree< K, V, C >::insert_node(node_type * target, value_type && val)
   {
     node_type * old_root = root_;
     size_t old_size = size_;
@@ -365,7 +391,7 @@ namespace savintsev
         node_type * new_node = new node_type{};
         try
         {
-          insert_data_in_node(new_node, val);
+          insert_data_in_node(new_node, std::move(val));
         }
         catch (...)
         {
@@ -373,21 +399,31 @@ namespace savintsev
           throw;
         }
         root_ = new_node;
+        rightmost_ = new_node;
         size_++;
         return {iterator(root_, new_node, 0), true};
       }
 
       node_type * current = target;
-      bool data_inserted = false;
+      size_t pos = insert_data_in_node(current, std::move(val));
+      if (current->len < 3)
+      {
+        size_++;
+        return {iterator(root_, current, pos), true};
+      }
 
+      bool rightmost = (target == rightmost_);
+      const key_type k = current->data[pos].first;
       try
       {
-        insert_data_in_node(current, val);
-        data_inserted = true;
-
         while (current && current->len == 3)
         {
+          bool leaf = (current == target);
           node_type * new_current = split_node(current);
+          if (leaf && rightmost)
+          {
+            rightmost_ = new_current->kids[new_current->len];
+          }
           if (new_current == current)
           {
             break;
@@ -402,17 +438,18 @@ namespace savintsev
         root_ = current;
         size_++;
 
-        return {lazy_find(val.first).first, true};
+        if (rightmost && pos == 2)
+        {
+          return {iterator(root_, rightmost_, rightmost_->len - 1), true};
+        }
+        return {lazy_find(k).first, true};
       }
       catch (...)
       {
-        if (data_inserted)
+        remove_data_from_node(target, k);
+        while (current && current != target)
         {
-          remove_data_from_node(target, val.first);
-          while (current && current != target)
-          {
-            current = merge_nodes(current);
-          }
+          current = merge_nodes(current);
         }
         throw;
       }
@@ -420,54 +457,54 @@ namespace savintsev
     catch (...)
     {
       root_ = old_root;
+      rightmost_ = nullptr;
       size_ = old_size;
       throw;
     }
   }
 
-  template< typename Key, typename Value, typename Compare >
-  void TwoThreeTree< Key, Value, Compare >::insert_data_in_node(node_type * node, const value_type & val)
+  template< typename K, typename V, typename C >
+  typename TwoThreeTree< K, V, C >::node_type * TwoThreeTree< K, V, C >::rightmost_leaf()
   {
-    assert(node->len < 3);
-
-    value_type tmp_data[3];
-    size_t tmp_len = node->len;
-
-    for (size_t i = 0; i < tmp_len; ++i)
+    if (!rightmost_)
     {
-      tmp_data[i] = node->data[i];
-    }
-
-    tmp_data[tmp_len++] = val;
-
-    if (tmp_len == 2)
-    {
-      if (!Compare{}(tmp_data[0].first, tmp_data[1].first))
+      node_type * node = root_;
+      while (node->kids[0])
       {
-        std::swap(tmp_data[0], tmp_data[1]);
+        node = node->kids[node->len];
       }
+      rightmost_ = node;
     }
-    else if (tmp_len == 3)
+    return rightmost_;
+  }
+
+  template< typename K, typename V, typename C >
+  bool TwoThreeTree< K, V, C >::is_append(const_iterator hint, const key_type & k)
+  {
+    if (hint != cend() || !root_ || root_->len == 0)
     {
-      if (!Compare{}(tmp_data[0].first, tmp_data[1].first))
-      {
-        std::swap(tmp_data[0], tmp_data[1]);
-      }
-      if (!Compare{}(tmp_data[1].first, tmp_data[2].first))
-      {
-        std::swap(tmp_data[1], tmp_data[2]);
-      }
-      if (!Compare{}(tmp_data[0].first, tmp_data[1].first))
-      {
-        std::swap(tmp_data[0], tmp_data[1]);
-      }
+      return false;
     }
+    node_type * leaf = rightmost_leaf();
+    return leaf->len != 0 && C{}(leaf->data[leaf->len - 1].first, k);
+  }
 
-    for (size_t i = 0; i < tmp_len; ++i)
+  template< typename Key, typename Value, typename Compare >
+  template< typename T >
+  size_t TwoThreeTree< Key, Value, Compare >::insert_data_in_node(node_type * node, T && val)
+  {
+    assert(node->len < 3);
+
+    size_t pos = node->len;
+    node->data[pos] = std::forward< T >(val);
+    node->len++;
+
+    while (pos > 0 && Compare{}(node->data[pos].first, node->data[pos - 1].first))
     {
-      node->data[i] = std::move(tmp_data[i]);
+      std::swap(node->data[pos], node->data[pos - 1]);
+      --pos;
     }
-    node->len = tmp_len;
+    return pos;
   }
 
   template< typename Key, typename Value, typename Compare >
@@ -485,13 +522,13 @@ namespace savintsev
     }
     if (node->len >= 1 && node->data[0].first == k)
     {
-      node->data[0] = node->data[1];
-      node->data[1] = node->data[2];
+      node->data[0] = std::move(node->data[1]);
+      node->data[1] = std::move(node->data[2]);
       node->len--;
     }
     else if (node->len == 2 && node->data[1].first == k)
     {
-      node->data[1] = node->data[2];
+      node->data[1] = std::move(node->data[2]);
       node->len--;
     }
   }
@@ -928,6 +965,7 @@ namespace savintsev
     }
     node_type * target = position.node_;
     node_type * closest = nullptr;
+    rightmost_ = nullptr;
     if (position.pos_ + 1 < 3 && target->kids[position.pos_ + 1])
     {
       closest = search_min(target->kids[position.pos_ + 1]);
@@ -956,6 +994,7 @@ namespace savintsev
     }
     node_type * target = result.first.node_;
     node_type * closest = search_min(target->kids[result.first.pos_ + 1]);
+    rightmost_ = nullptr;
     if (closest)
     {
       std::swap(target->data[result.first.pos_], closest->data[0]);
@@ -1045,10 +1084,10 @@ namespace savintsev
       }
     }
 
-    insert_data_in_node(left, node->data[0]);
+    insert_data_in_node(left, std::move_if_noexcept(node->data[0]));
     try
     {
-      insert_data_in_node(right, node->data[2]);
+      insert_data_in_node(right, std::move_if_noexcept(node->data[2]));
     }
     catch (...)
     {
@@ -1062,7 +1101,7 @@ namespace savintsev
       {
         node_type * parent = node->father;
 
-        insert_data_in_node(parent, node->data[1]);
+        insert_data_in_node(parent, std::move_if_noexcept(node->data[1]));
 
         if (parent->kids[0] == node)
         {
@@ -1090,7 +1129,7 @@ namespace savintsev
       {
         left->father = node;
         right->father = node;
-        node->data[0] = node->data[1];
+        node->data[0] = std::move(node->data[1]);
         node->kids[0] = left;
         node->kids[1] = right;
         node->kids[2] = nullptr;
@@ -1120,7 +1159,109 @@ namespace savintsev
     {
       return {result.first, false};
     }
-    return insert_node(result.first.node_, val);
+    return insert_node(result.first.node_, value_type(val));
+  }
+
+  template< typename K, typename V, typename C >
+  std::pair
+  <
+    typename TwoThreeTree< K, V, C >::iterator,
+    bool
+  >
+  TwoThreeTree< K, V, C >::insert(value_type && val)
+  {
+    auto result = lazy_find(val.first);
+    if (result.second)
+    {
+      return {result.first, false};
+    }
+    return insert_node(result.first.node_, std::move(val));
+  }
+
+  template< typename K, typename V, typename C >
+  template< typename... Args >
+  std::pair
+  <
+    typename TwoThreeTree< K, V, C >::iterator,
+    bool
+  >
+  TwoThreeTree< K, V, C >::emplace(Args &&... args)
+  {
+    return insert(value_type(std::forward< Args >(args)...));
+  }
+
+  template< typename K, typename V, typename C >
+  template< typename... Args >
+  typename TwoThreeTree< K, V, C >::iterator TwoThreeTree< K, V, C >::emplace_hint(const_iterator hint, Args &&... args)
+  {
+    value_type val(std::forward< Args >(args)...);
+    if (is_append(hint, val.first))
+    {
+      return insert_node(rightmost_, std::move(val)).first;
+    }
+    return insert(std::move(val)).first;
+  }
+
+  template< typename K, typename V, typename C >
+  template< typename... Args >
+  std::pair
+  <
+    typename TwoThreeTree< K, V, C >::iterator,
+    bool
+  >
+  TwoThreeTree< K, V, C >::try_emplace(const key_type & k, Args &&... args)
+  {
+    auto result = lazy_find(k);
+    if (result.second)
+    {
+      return {result.first, false};
+    }
+    value_type val(std::piecewise_construct, std::forward_as_tuple(k), std::forward_as_tuple(std::forward< Args >(args)...));
+    return insert_node(result.first.node_, std::move(val));
+  }
+
+  template< typename K, typename V, typename C >
+  template< typename... Args >
+  std::pair
+  <
+    typename TwoThreeTree< K, V, C >::iterator,
+    bool
+  >
+  TwoThreeTree< K, V, C >::try_emplace(key_type && k, Args &&... args)
+  {
+    auto result = lazy_find(k);
+    if (result.second)
+    {
+      return {result.first, false};
+    }
+    value_type val(std::piecewise_construct, std::forward_as_tuple(std::move(k)), std::forward_as_tuple(std::forward< Args >(args)...));
+    return insert_node(result.first.node_, std::move(val));
+  }
+
+  template< typename K, typename V, typename C >
+  template< typename... Args >
+  typename TwoThreeTree< K, V, C >::iterator
+  TwoThreeTree< K, V, C >::try_emplace(const_iterator hint, const key_type & k, Args &&... args)
+  {
+    if (is_append(hint, k))
+    {
+      value_type val(std::piecewise_construct, std::forward_as_tuple(k), std::forward_as_tuple(std::forward< Args >(args)...));
+      return insert_node(rightmost_, std::move(val)).first;
+    }
+    return try_emplace(k, std::forward< Args >(args)...).first;
+  }
+
+  template< typename K, typename V, typename C >
+  template< typename... Args >
+  typename TwoThreeTree< K, V, C >::iterator
+  TwoThreeTree< K, V, C >::try_emplace(const_iterator hint, key_type && k, Args &&... args)
+  {
+    if (is_append(hint, k))
+    {
+      value_type val(std::piecewise_construct, std::forward_as_tuple(std::move(k)), std::forward_as_tuple(std::forward< Args >(args)...));
+      return insert_node(rightmost_, std::move(val)).first;
+    }
+    return try_emplace(std::move(k), std::forward< Args >(args)...).first;
   }
 
   template< typename K, typename V, typename C >